@@ -0,0 +1,130 @@
+"""
+Source/ReflectionDemo/ReflectionHelperBenchmark.h를 다시 생성합니다.
+
+벤치마크용 구조체의 멤버 수를 바꾸려면 STRUCT_SIZES를 고친 뒤 저장소 루트에서 실행합니다.
+    python Scripts/GenerateReflectionBenchmarkStructs.py
+"""
+
+import os
+
+STRUCT_SIZES = [12, 50, 100, 500]
+
+# (C++ 타입, 기본값) 을 이 순서대로 반복
+MEMBER_PATTERN = [
+    ("int32", "0"),
+    ("int32", "0"),
+    ("int32", "0"),
+    ("int32", "0"),
+    ("float", "0.f"),
+    ("float", "0.f"),
+    ("int16", "0"),
+    ("bool", "false"),
+]
+
+DIRECT_TYPES = ["int32", "float", "int16", "bool"]
+
+OUTPUT_PATH = os.path.join(os.path.dirname(__file__), "..", "Source", "ReflectionDemo", "ReflectionHelperBenchmark.h")
+
+HEADER = """// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ReflectionHelperBenchmark.generated.h"
+
+
+/*
+ * 벤치마크용 구조체들
+ * 멤버 타입은 int32 4개, float 2개, int16 1개, bool 1개의 순서를 반복하므로
+ * 순회할 타입에 따라 전체 멤버 중 일치하는 멤버의 비율이 50%, 25%, 12.5%가 됩니다.
+ * ForEachDirect는 Reflection 없이 멤버에 직접 접근하는 기준 구현입니다.
+ * 이 파일은 Scripts/GenerateReflectionBenchmarkStructs.py로 생성되므로 직접 고치지 말고 스크립트를 고친 뒤 다시 생성합니다.
+ */
+"""
+
+FOOTER = """
+
+/**
+ * VisitReachable 벤치마크에서 객체 그래프를 만들기 위한 노드
+ */
+UCLASS()
+class UReflectionBenchmarkNode : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<TObjectPtr<UReflectionBenchmarkNode>> Children;
+
+	UPROPERTY()
+	TObjectPtr<UReflectionBenchmarkNode> Parent;
+
+	UPROPERTY()
+	int32 Value = 0;
+};
+
+
+/**
+ * FReflectionHelper의 순회 비용을 TFieldIterator를 직접 쓰는 방식, 멤버에 직접 접근하는 방식과 비교하는 Commandlet
+ * 결과는 로그와 Saved/Benchmarks/ReflectionHelperBenchmark.csv에 기록됩니다.
+ *
+ * 실행 예시)
+ * UnrealEditor-Cmd ReflectionDemo.uproject -run=ReflectionHelperBenchmark -nullrhi -unattended -nopause
+ *
+ * 옵션)
+ * -Quick : 컨테이너 개수를 1000개까지만 측정
+ * -ColdStart : 순회 대신 Layout이 없는 상태에서 모듈 전체를 PrewarmModuleLayouts 하는 시간을 캐시 파일 유무 별로 측정
+ * -Reachability : 순회 대신 이진 트리로 연결된 객체 최대 100만 개에 대해 VisitReachable 하는 시간을 측정 (-Quick이면 10만 개까지)
+ * -Csv=<경로> : CSV 파일 경로 지정
+ */
+UCLASS()
+class UReflectionHelperBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UReflectionHelperBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
+"""
+
+
+def generate_struct(size):
+    lines = ["", "USTRUCT()", f"struct FReflectionBenchmarkStruct{size}", "{", "\tGENERATED_BODY()"]
+
+    members_by_type = {each: [] for each in DIRECT_TYPES}
+    for index in range(size):
+        cpp_type, default = MEMBER_PATTERN[index % len(MEMBER_PATTERN)]
+        members_by_type[cpp_type].append(index)
+        lines += ["", "\tUPROPERTY()", f"\t{cpp_type} P{index} = {default};"]
+
+    lines += ["", "\ttemplate <typename T, typename FuncType>", "\tvoid ForEachDirect(FuncType&& Func)", "\t{"]
+
+    first = True
+    for cpp_type in DIRECT_TYPES:
+        if not members_by_type[cpp_type]:
+            continue
+
+        keyword = "if constexpr" if first else "else if constexpr"
+        first = False
+
+        lines += [f"\t\t{keyword} (std::is_same_v<T, {cpp_type}>)", "\t\t{"]
+        lines += [f"\t\t\tFunc(P{index});" for index in members_by_type[cpp_type]]
+        lines += ["\t\t}"]
+
+    lines += ["\t}", "};", ""]
+    return "\n".join(lines)
+
+
+def main():
+    body = "\n".join(generate_struct(size) for size in STRUCT_SIZES)
+
+    # 엔진 소스와 같이 UTF-8 BOM + LF
+    with open(OUTPUT_PATH, "w", encoding="utf-8-sig", newline="\n") as file:
+        file.write(HEADER + body.rstrip("\n") + "\n" + FOOTER)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,2796 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ReflectionHelper.h"
+
+#include "Engine/AssetManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/StructuredArchive.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+#include <atomic>
+
+
+DEFINE_LOG_CATEGORY(LogReflectionHelper);
+
+
+namespace Details
+{
+	FReflectionLayoutCache& FReflectionLayoutCache::Get()
+	{
+		static FReflectionLayoutCache Instance;
+		return Instance;
+	}
+
+	FReflectionLayoutCache::FReflectionLayoutCache()
+	{
+		// Hot Reload / Live Coding 후에는 Property의 오프셋이 바뀌었을 수 있음
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+		{
+			Invalidate();
+		});
+	}
+
+	void FReflectionLayoutCache::Invalidate()
+	{
+		FWriteScopeLock WriteLock{ Lock };
+		Entries.Reset();
+	}
+
+	FReflectionLayoutCache::FLayoutPtr FReflectionLayoutCache::Find(const UStruct* Struct, const void* Kind) const
+	{
+		FReadScopeLock ReadLock{ Lock };
+
+		const FEntry* Entry = Entries.Find(FKey{ Struct, Kind });
+		if (!Entry)
+		{
+			return nullptr;
+		}
+
+		// 같은 주소에 다른 UStruct가 생성되었거나 Property들이 다시 링크된 경우 무효
+		if (Entry->Struct.Get() != Struct || Entry->PropertyLink != Struct->PropertyLink)
+		{
+			return nullptr;
+		}
+
+		return Entry->Layout;
+	}
+
+	FReflectionLayoutCache::FLayoutRef FReflectionLayoutCache::Add(const UStruct* Struct, const void* Kind, FLayoutRef Layout)
+	{
+		FWriteScopeLock WriteLock{ Lock };
+
+		// 락을 잡지 않은 사이에 다른 스레드가 먼저 만들어 넣었을 수 있음 (결과는 같으므로 덮어써도 무방)
+		Entries.Add(FKey{ Struct, Kind }, FEntry{ TWeakObjectPtr<const UStruct>{ Struct }, Struct->PropertyLink, Layout });
+		return Layout;
+	}
+}
+
+
+namespace
+{
+	/**
+	 * UStruct가 직접 선언한 멤버와 그 멤버의 Inner, KeyProp, ValueProp 등의 타입 시그니처
+	 */
+	struct FTypeSignatureLayout : Details::FReflectionLayout
+	{
+		TMap<const FProperty*, uint64> Signatures;
+
+		explicit FTypeSignatureLayout(const UStruct* Struct)
+		{
+			// 부모의 멤버는 부모의 Layout에 들어감
+			for (TFieldIterator<FProperty> It{ Struct, EFieldIteratorFlags::ExcludeSuper }; It; ++It)
+			{
+				Add(*It);
+			}
+		}
+
+	private:
+		uint64 Add(const FProperty* Property)
+		{
+			using namespace Details;
+
+			uint64 Signature;
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				Signature = MixTypeSignature(ETypeSignatureTag::Array, Add(ArrayProperty->Inner));
+			}
+			else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+			{
+				Signature = MixTypeSignature(MixTypeSignature(ETypeSignatureTag::Map, Add(MapProperty->KeyProp)), Add(MapProperty->ValueProp));
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+			{
+				Signature = MixTypeSignature(ETypeSignatureTag::Set, Add(SetProperty->ElementProp));
+			}
+			else
+			{
+				Signature = ComputeTypeSignature(Property);
+			}
+
+			Signatures.Add(Property, Signature);
+			return Signature;
+		}
+	};
+}
+
+
+namespace Details
+{
+	namespace
+	{
+		uint64 HashPathName(const UObject* Object)
+		{
+			TStringBuilder<256> Path;
+			Object->GetPathName(nullptr, Path);
+			return FXxHash64::HashBuffer(Path.GetData(), Path.Len() * sizeof(TCHAR)).Hash;
+		}
+	}
+
+	uint64 HashStructIdentity(const UStruct* Struct)
+	{
+		return HashPathName(Struct);
+	}
+
+	uint64 HashEnumIdentity(const UEnum* Enum)
+	{
+		return HashPathName(Enum);
+	}
+
+	uint64 ComputeTypeSignature(const FProperty* Property)
+	{
+		if (Property->IsA<FInt16Property>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Int16);
+		}
+		if (Property->IsA<FIntProperty>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Int32);
+		}
+		if (Property->IsA<FInt64Property>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Int64);
+		}
+		// TEnumAsByte<E> 멤버도 FByteProperty
+		if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+		{
+			return ByteProperty->Enum
+				? MixTypeSignature(ETypeSignatureTag::EnumAsByte, HashEnumIdentity(ByteProperty->Enum))
+				: static_cast<uint64>(ETypeSignatureTag::UInt8);
+		}
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::Enum, HashEnumIdentity(EnumProperty->GetEnum()));
+		}
+		if (Property->IsA<FFloatProperty>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Float);
+		}
+		if (Property->IsA<FDoubleProperty>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Double);
+		}
+		if (Property->IsA<FBoolProperty>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Bool);
+		}
+		if (Property->IsA<FStrProperty>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::String);
+		}
+		if (Property->IsA<FNameProperty>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Name);
+		}
+		if (Property->IsA<FTextProperty>())
+		{
+			return static_cast<uint64>(ETypeSignatureTag::Text);
+		}
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::Struct, HashStructIdentity(StructProperty->Struct));
+		}
+		// FSoftClassProperty는 FSoftObjectProperty를 상속하므로 먼저 확인
+		if (const FSoftClassProperty* SoftClassProperty = CastField<FSoftClassProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::SoftClass, HashStructIdentity(SoftClassProperty->MetaClass));
+		}
+		if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::SoftObject, HashStructIdentity(SoftObjectProperty->PropertyClass));
+		}
+		// FClassProperty도 UClass* 멤버로 취급하고, TObjectPtr 멤버도 UObject* 멤버와 같은 시그니처를 가짐
+		if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::Object, HashStructIdentity(ObjectProperty->PropertyClass));
+		}
+		if (const FWeakObjectProperty* WeakObjectProperty = CastField<FWeakObjectProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::WeakObject, HashStructIdentity(WeakObjectProperty->PropertyClass));
+		}
+		if (const FLazyObjectProperty* LazyObjectProperty = CastField<FLazyObjectProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::LazyObject, HashStructIdentity(LazyObjectProperty->PropertyClass));
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::Array, ComputeTypeSignature(ArrayProperty->Inner));
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			return MixTypeSignature(
+				MixTypeSignature(ETypeSignatureTag::Map, ComputeTypeSignature(MapProperty->KeyProp)),
+				ComputeTypeSignature(MapProperty->ValueProp));
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			return MixTypeSignature(ETypeSignatureTag::Set, ComputeTypeSignature(SetProperty->ElementProp));
+		}
+
+		// 어떤 C++ 타입의 시그니처와도 일치하지 않음
+		return 0;
+	}
+
+	uint64 GetTypeSignature(const FProperty* Property)
+	{
+		const UStruct* Owner = Property->GetOwnerStruct();
+		if (!Owner)
+		{
+			return ComputeTypeSignature(Property);
+		}
+
+		const auto Layout = FReflectionLayoutCache::Get().FindOrAdd<FTypeSignatureLayout>(Owner);
+		if (const uint64* Found = Layout->Signatures.Find(Property))
+		{
+			return *Found;
+		}
+
+		return ComputeTypeSignature(Property);
+	}
+}
+
+
+namespace
+{
+	template <typename T>
+	int64 ScalarSum(TArrayView<const T> Values)
+	{
+		int64 Result = 0;
+		for (const T Each : Values)
+		{
+			Result += Each;
+		}
+		return Result;
+	}
+
+	template <typename T>
+	T ScalarMin(TArrayView<const T> Values, T Result = TNumericLimits<T>::Max())
+	{
+		for (const T Each : Values)
+		{
+			Result = FMath::Min(Result, Each);
+		}
+		return Result;
+	}
+
+	template <typename T>
+	T ScalarMax(TArrayView<const T> Values, T Result = TNumericLimits<T>::Lowest())
+	{
+		for (const T Each : Values)
+		{
+			Result = FMath::Max(Result, Each);
+		}
+		return Result;
+	}
+
+	template <typename T>
+	void ScalarClamp(TArrayView<T> Values, T MinValue, T MaxValue)
+	{
+		for (T& Each : Values)
+		{
+			Each = FMath::Clamp(Each, MinValue, MaxValue);
+		}
+	}
+
+	// 4개씩 처리하고 남은 앞부분의 개수
+	int32 GetNumVectorized(int32 Num)
+	{
+		return Num & ~3;
+	}
+
+	float ReduceMin(const VectorRegister4Float& Vector)
+	{
+		alignas(16) float Lanes[4];
+		VectorStoreAligned(Vector, Lanes);
+		return FMath::Min(FMath::Min(Lanes[0], Lanes[1]), FMath::Min(Lanes[2], Lanes[3]));
+	}
+
+	float ReduceMax(const VectorRegister4Float& Vector)
+	{
+		alignas(16) float Lanes[4];
+		VectorStoreAligned(Vector, Lanes);
+		return FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+	}
+
+	int32 ReduceMin(const VectorRegister4Int& Vector)
+	{
+		alignas(16) int32 Lanes[4];
+		VectorIntStore(Vector, Lanes);
+		return FMath::Min(FMath::Min(Lanes[0], Lanes[1]), FMath::Min(Lanes[2], Lanes[3]));
+	}
+
+	int32 ReduceMax(const VectorRegister4Int& Vector)
+	{
+		alignas(16) int32 Lanes[4];
+		VectorIntStore(Vector, Lanes);
+		return FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+	}
+}
+
+
+float FReflectionColumnKernels::Sum(TArrayView<const float> Values)
+{
+	const float* Data = Values.GetData();
+	const int32 NumVectorized = GetNumVectorized(Values.Num());
+
+	VectorRegister4Float Accumulated = VectorZeroFloat();
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		Accumulated = VectorAdd(Accumulated, VectorLoad(Data + i));
+	}
+
+	alignas(16) float Lanes[4];
+	VectorStoreAligned(Accumulated, Lanes);
+
+	float Result = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+	for (int32 i = NumVectorized; i < Values.Num(); ++i)
+	{
+		Result += Data[i];
+	}
+	return Result;
+}
+
+int64 FReflectionColumnKernels::Sum(TArrayView<const int32> Values)
+{
+	// 32비트 레인으로 더하면 넘칠 수 있으므로 64비트로 더함 (컴파일러가 벡터화 함)
+	return ScalarSum(Values);
+}
+
+int64 FReflectionColumnKernels::Sum(TArrayView<const int16> Values)
+{
+	return ScalarSum(Values);
+}
+
+float FReflectionColumnKernels::Min(TArrayView<const float> Values)
+{
+	const float* Data = Values.GetData();
+	const int32 NumVectorized = GetNumVectorized(Values.Num());
+
+	VectorRegister4Float Result = VectorSetFloat1(TNumericLimits<float>::Max());
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		Result = VectorMin(Result, VectorLoad(Data + i));
+	}
+
+	return ScalarMin(Values.RightChop(NumVectorized), ReduceMin(Result));
+}
+
+int32 FReflectionColumnKernels::Min(TArrayView<const int32> Values)
+{
+	const int32* Data = Values.GetData();
+	const int32 NumVectorized = GetNumVectorized(Values.Num());
+
+	VectorRegister4Int Result = VectorIntSet1(TNumericLimits<int32>::Max());
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		Result = VectorIntMin(Result, VectorIntLoad(Data + i));
+	}
+
+	return ScalarMin(Values.RightChop(NumVectorized), ReduceMin(Result));
+}
+
+int16 FReflectionColumnKernels::Min(TArrayView<const int16> Values)
+{
+	return ScalarMin(Values);
+}
+
+float FReflectionColumnKernels::Max(TArrayView<const float> Values)
+{
+	const float* Data = Values.GetData();
+	const int32 NumVectorized = GetNumVectorized(Values.Num());
+
+	VectorRegister4Float Result = VectorSetFloat1(TNumericLimits<float>::Lowest());
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		Result = VectorMax(Result, VectorLoad(Data + i));
+	}
+
+	return ScalarMax(Values.RightChop(NumVectorized), ReduceMax(Result));
+}
+
+int32 FReflectionColumnKernels::Max(TArrayView<const int32> Values)
+{
+	const int32* Data = Values.GetData();
+	const int32 NumVectorized = GetNumVectorized(Values.Num());
+
+	VectorRegister4Int Result = VectorIntSet1(TNumericLimits<int32>::Lowest());
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		Result = VectorIntMax(Result, VectorIntLoad(Data + i));
+	}
+
+	return ScalarMax(Values.RightChop(NumVectorized), ReduceMax(Result));
+}
+
+int16 FReflectionColumnKernels::Max(TArrayView<const int16> Values)
+{
+	return ScalarMax(Values);
+}
+
+void FReflectionColumnKernels::Clamp(TArrayView<float> Values, float MinValue, float MaxValue)
+{
+	float* Data = Values.GetData();
+	const int32 NumVectorized = GetNumVectorized(Values.Num());
+
+	const VectorRegister4Float MinVector = VectorSetFloat1(MinValue);
+	const VectorRegister4Float MaxVector = VectorSetFloat1(MaxValue);
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		VectorStore(VectorMin(VectorMax(VectorLoad(Data + i), MinVector), MaxVector), Data + i);
+	}
+
+	ScalarClamp(Values.RightChop(NumVectorized), MinValue, MaxValue);
+}
+
+void FReflectionColumnKernels::Clamp(TArrayView<int32> Values, int32 MinValue, int32 MaxValue)
+{
+	int32* Data = Values.GetData();
+	const int32 NumVectorized = GetNumVectorized(Values.Num());
+
+	const VectorRegister4Int MinVector = VectorIntSet1(MinValue);
+	const VectorRegister4Int MaxVector = VectorIntSet1(MaxValue);
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		VectorIntStore(VectorIntMin(VectorIntMax(VectorIntLoad(Data + i), MinVector), MaxVector), Data + i);
+	}
+
+	ScalarClamp(Values.RightChop(NumVectorized), MinValue, MaxValue);
+}
+
+void FReflectionColumnKernels::Clamp(TArrayView<int16> Values, int16 MinValue, int16 MaxValue)
+{
+	ScalarClamp(Values, MinValue, MaxValue);
+}
+
+
+namespace
+{
+	/**
+	 * 호출자가 준 버퍼에 직접 읽고 쓰는 아카이브
+	 * 저장 시 버퍼가 모자라면 더 이상 쓰지 않고 위치만 전진시켜 필요한 크기를 알 수 있게 합니다.
+	 */
+	class FSnapshotArchive final : public FArchive
+	{
+	public:
+		FSnapshotArchive(uint8* InData, int64 InCapacity, bool bLoading)
+			: Data(InData), Capacity(InCapacity)
+		{
+			SetIsLoading(bLoading);
+			SetIsSaving(!bLoading);
+			SetIsPersistent(false);
+		}
+
+		using FArchive::operator<<;
+
+		virtual void Serialize(void* Value, int64 Length) override
+		{
+			if (Length <= 0)
+			{
+				return;
+			}
+
+			if (!IsError() && Position + Length <= Capacity)
+			{
+				if (IsLoading())
+				{
+					FMemory::Memcpy(Value, Data + Position, Length);
+				}
+				else
+				{
+					FMemory::Memcpy(Data + Position, Value, Length);
+				}
+			}
+			else if (IsLoading())
+			{
+				FMemory::Memzero(Value, Length);
+				SetError();
+			}
+			else
+			{
+				bOverflowed = true;
+			}
+
+			Position += Length;
+		}
+
+		// 같은 프로세스 안에서만 읽으므로 FName은 내부 표현 그대로 기록
+		virtual FArchive& operator<<(FName& Value) override
+		{
+			Serialize(&Value, sizeof(FName));
+			return *this;
+		}
+
+		// 롤백 사이에 객체가 파괴되었을 수 있으므로 Weak 포인터로 기록
+		virtual FArchive& operator<<(UObject*& Value) override
+		{
+			FWeakObjectPtr Weak;
+			if (IsSaving())
+			{
+				Weak = Value;
+			}
+
+			Serialize(&Weak, sizeof(FWeakObjectPtr));
+
+			if (IsLoading())
+			{
+				Value = Weak.Get();
+			}
+			return *this;
+		}
+
+		virtual int64 Tell() override
+		{
+			return Position;
+		}
+
+		virtual int64 TotalSize() override
+		{
+			return Capacity;
+		}
+
+		virtual FString GetArchiveName() const override
+		{
+			return TEXT("FSnapshotArchive");
+		}
+
+		bool HasOverflowed() const
+		{
+			return bOverflowed;
+		}
+
+		/**
+		 * 로드 중 읽은 원소 개수가 남은 버퍼로 감당 가능한지 확인합니다.
+		 * 손상된 버퍼 때문에 거대한 할당이 일어나는 것을 막기 위한 것이므로 원소마다 최소 1바이트가 기록된다고 가정합니다.
+		 */
+		bool IsValidCount(int32 Num)
+		{
+			if (Num < 0 || Num > Capacity - Position)
+			{
+				SetError();
+				return false;
+			}
+			return true;
+		}
+
+	private:
+		uint8* Data;
+		int64 Capacity;
+		int64 Position = 0;
+		bool bOverflowed = false;
+	};
+
+
+	void SerializeStruct(FSnapshotArchive& Ar, const Details::FPodSpanLayout& Layout, void* Container);
+
+	/**
+	 * 값 하나를 아카이브 방향에 맞게 기록하거나 읽습니다. Property는 ArrayDim이 1이라고 가정합니다.
+	 */
+	void SerializeValue(FSnapshotArchive& Ar, const FProperty* Property, void* ValuePtr)
+	{
+		if (Details::FPodSpanLayout::IsPlainOldData(Property))
+		{
+			Ar.Serialize(ValuePtr, Property->GetSize());
+		}
+		else if (CastField<FNameProperty>(Property))
+		{
+			Ar << *static_cast<FName*>(ValuePtr);
+		}
+		else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			uint8 Value = Ar.IsSaving() && BoolProperty->GetPropertyValue(ValuePtr);
+			Ar << Value;
+
+			if (Ar.IsLoading())
+			{
+				BoolProperty->SetPropertyValue(ValuePtr, Value != 0);
+			}
+		}
+		else if (CastField<FStrProperty>(Property))
+		{
+			TArray<TCHAR>& Chars = static_cast<FString*>(ValuePtr)->GetCharArray();
+
+			int32 Num = Chars.Num();
+			Ar << Num;
+
+			if (Ar.IsLoading())
+			{
+				if (!Ar.IsValidCount(Num))
+				{
+					return;
+				}
+				Chars.SetNumUninitialized(Num, false);
+			}
+
+			Ar.Serialize(Chars.GetData(), Num * sizeof(TCHAR));
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper{ ArrayProperty, ValuePtr };
+
+			int32 Num = Helper.Num();
+			Ar << Num;
+
+			if (Ar.IsLoading())
+			{
+				if (!Ar.IsValidCount(Num))
+				{
+					return;
+				}
+				Helper.Resize(Num);
+			}
+
+			const FProperty* Inner = ArrayProperty->Inner;
+			if (Details::FPodSpanLayout::IsPlainOldData(Inner))
+			{
+				Ar.Serialize(Helper.GetRawPtr(), static_cast<int64>(Num) * Inner->GetSize());
+			}
+			else if (const FStructProperty* StructInner = CastField<FStructProperty>(Inner);
+				StructInner && !(StructInner->Struct->StructFlags & STRUCT_SerializeNative))
+			{
+				// 원소마다 캐시를 찾지 않도록 한 번만 가져옴
+				const auto Layout = Details::FPodSpanLayout::Get(StructInner->Struct);
+				for (int32 Index = 0; Index < Num; ++Index)
+				{
+					SerializeStruct(Ar, *Layout, Helper.GetRawPtr(Index));
+				}
+			}
+			else
+			{
+				for (int32 Index = 0; Index < Num; ++Index)
+				{
+					SerializeValue(Ar, Inner, Helper.GetRawPtr(Index));
+				}
+			}
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper Helper{ SetProperty, ValuePtr };
+
+			int32 Num = Helper.Num();
+			Ar << Num;
+
+			if (Ar.IsSaving())
+			{
+				Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+				{
+					SerializeValue(Ar, SetProperty->ElementProp, Helper.GetElementPtr(Index));
+				});
+			}
+			else if (Ar.IsValidCount(Num))
+			{
+				Helper.EmptyElements(Num);
+				for (int32 Each = 0; Each < Num; ++Each)
+				{
+					const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+					SerializeValue(Ar, SetProperty->ElementProp, Helper.GetElementPtr(Index));
+				}
+				Helper.Rehash();
+			}
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper Helper{ MapProperty, ValuePtr };
+
+			int32 Num = Helper.Num();
+			Ar << Num;
+
+			if (Ar.IsSaving())
+			{
+				Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+				{
+					SerializeValue(Ar, MapProperty->KeyProp, Helper.GetKeyPtr(Index));
+					SerializeValue(Ar, MapProperty->ValueProp, Helper.GetValuePtr(Index));
+				});
+			}
+			else if (Ar.IsValidCount(Num))
+			{
+				Helper.EmptyValues(Num);
+				for (int32 Each = 0; Each < Num; ++Each)
+				{
+					const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+					SerializeValue(Ar, MapProperty->KeyProp, Helper.GetKeyPtr(Index));
+					SerializeValue(Ar, MapProperty->ValueProp, Helper.GetValuePtr(Index));
+				}
+				Helper.Rehash();
+			}
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			StructProperty && !(StructProperty->Struct->StructFlags & STRUCT_SerializeNative))
+		{
+			SerializeStruct(Ar, *Details::FPodSpanLayout::Get(StructProperty->Struct), ValuePtr);
+		}
+		else if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+		{
+			UObject* Object = Ar.IsSaving() ? ObjectProperty->GetObjectPropertyValue(ValuePtr) : nullptr;
+			Ar << Object;
+
+			if (Ar.IsLoading())
+			{
+				ObjectProperty->SetObjectPropertyValue(ValuePtr, Object);
+			}
+		}
+		else
+		{
+			// 드문 타입들은 엔진의 직렬화를 그대로 사용 (FText, Soft 포인터 등은 여기서 할당이 일어날 수 있음)
+			FStructuredArchiveFromArchive Structured{ Ar };
+			Property->SerializeItem(Structured.GetSlot(), ValuePtr, nullptr);
+		}
+	}
+
+	void SerializeStruct(FSnapshotArchive& Ar, const Details::FPodSpanLayout& Layout, void* Container)
+	{
+		uint8* const Base = static_cast<uint8*>(Container);
+
+		for (const Details::FPodSpanLayout::FSpan& Span : Layout.Spans)
+		{
+			Ar.Serialize(Base + Span.Offset, Span.Size);
+		}
+
+		for (const int32 Index : Layout.OtherMembers)
+		{
+			const FProperty* Property = Layout.Properties[Index];
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				SerializeValue(Ar, Property, Property->ContainerPtrToValuePtr<void>(Container, ArrayIndex));
+			}
+		}
+	}
+
+	/**
+	 * 스냅샷의 맨 앞에 기록하는 타입 정보
+	 * 같은 프로세스 안에서만 쓰이므로 UStruct의 주소와 크기로 충분합니다.
+	 */
+	struct FSnapshotHeader
+	{
+		uint64 Struct;
+		int32 StructureSize;
+	};
+
+	void SerializeHeader(FSnapshotArchive& Ar, FSnapshotHeader& Header)
+	{
+		Ar << Header.Struct;
+		Ar << Header.StructureSize;
+	}
+}
+
+
+namespace
+{
+	void HashStruct(FXxHash64Builder& Builder, const Details::FPodSpanLayout& Layout, const void* Container, const TBitArray<>* Filter);
+
+	void HashString(FXxHash64Builder& Builder, FStringView String)
+	{
+		const int32 Len = String.Len();
+		Builder.Update(&Len, sizeof(Len));
+		Builder.Update(String.GetData(), Len * sizeof(TCHAR));
+	}
+
+	/**
+	 * 값 하나를 해시합니다. Property는 ArrayDim이 1이라고 가정합니다.
+	 */
+	void HashValue(FXxHash64Builder& Builder, const FProperty* Property, const void* ValuePtr)
+	{
+		if (Details::FPodSpanLayout::IsPlainOldData(Property))
+		{
+			Builder.Update(ValuePtr, Property->GetSize());
+		}
+		else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			const uint8 Value = BoolProperty->GetPropertyValue(ValuePtr);
+			Builder.Update(&Value, sizeof(Value));
+		}
+		else if (CastField<FNameProperty>(Property))
+		{
+			TStringBuilder<FName::StringBufferSize> String;
+			static_cast<const FName*>(ValuePtr)->AppendString(String);
+			HashString(Builder, String);
+		}
+		else if (CastField<FStrProperty>(Property))
+		{
+			HashString(Builder, *static_cast<const FString*>(ValuePtr));
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper{ ArrayProperty, ValuePtr };
+
+			const int32 Num = Helper.Num();
+			Builder.Update(&Num, sizeof(Num));
+
+			const FProperty* Inner = ArrayProperty->Inner;
+			if (Details::FPodSpanLayout::IsPlainOldData(Inner))
+			{
+				Builder.Update(Helper.GetRawPtr(), static_cast<uint64>(Num) * Inner->GetSize());
+			}
+			else if (const FStructProperty* StructInner = CastField<FStructProperty>(Inner))
+			{
+				// 원소마다 캐시를 찾지 않도록 한 번만 가져옴
+				const auto Layout = Details::FPodSpanLayout::Get(StructInner->Struct);
+				for (int32 Index = 0; Index < Num; ++Index)
+				{
+					HashStruct(Builder, *Layout, Helper.GetRawPtr(Index), nullptr);
+				}
+			}
+			else
+			{
+				for (int32 Index = 0; Index < Num; ++Index)
+				{
+					HashValue(Builder, Inner, Helper.GetRawPtr(Index));
+				}
+			}
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper Helper{ SetProperty, ValuePtr };
+
+			// 원소마다 따로 해시해서 더하므로 순서와 무관함
+			uint64 Sum = 0;
+			Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+			{
+				FXxHash64Builder ElementBuilder;
+				HashValue(ElementBuilder, SetProperty->ElementProp, Helper.GetElementPtr(Index));
+				Sum += ElementBuilder.Finalize().Hash;
+			});
+
+			const int32 Num = Helper.Num();
+			Builder.Update(&Num, sizeof(Num));
+			Builder.Update(&Sum, sizeof(Sum));
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper Helper{ MapProperty, ValuePtr };
+
+			uint64 Sum = 0;
+			Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+			{
+				FXxHash64Builder PairBuilder;
+				HashValue(PairBuilder, MapProperty->KeyProp, Helper.GetKeyPtr(Index));
+				HashValue(PairBuilder, MapProperty->ValueProp, Helper.GetValuePtr(Index));
+				Sum += PairBuilder.Finalize().Hash;
+			});
+
+			const int32 Num = Helper.Num();
+			Builder.Update(&Num, sizeof(Num));
+			Builder.Update(&Sum, sizeof(Sum));
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			HashStruct(Builder, *Details::FPodSpanLayout::Get(StructProperty->Struct), ValuePtr, nullptr);
+		}
+		else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
+			ObjectProperty && !Property->IsA<FSoftObjectProperty>())
+		{
+			TStringBuilder<256> Path;
+			if (const UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr))
+			{
+				Object->GetPathName(nullptr, Path);
+			}
+			HashString(Builder, Path);
+		}
+		else if (Property->IsA<FSoftObjectProperty>())
+		{
+			// 로드하지 않고 경로만 해시 (FSoftClassProperty 포함)
+			TStringBuilder<256> Path;
+			static_cast<const FSoftObjectPtr*>(ValuePtr)->GetUniqueID().AppendString(Path);
+			HashString(Builder, Path);
+		}
+		else
+		{
+			// 드문 타입들은 텍스트로 내보내서 해시
+			FString Text;
+			Property->ExportTextItem_Direct(Text, ValuePtr, nullptr, nullptr, PPF_None);
+			HashString(Builder, Text);
+		}
+	}
+
+	void HashStruct(FXxHash64Builder& Builder, const Details::FPodSpanLayout& Layout, const void* Container, const TBitArray<>* Filter)
+	{
+		const uint8* const Base = static_cast<const uint8*>(Container);
+
+		for (const Details::FPodSpanLayout::FSpan& Span : Layout.Spans)
+		{
+			if (!Filter)
+			{
+				Builder.Update(Base + Span.Offset, Span.Size);
+				continue;
+			}
+
+			for (int32 Each = Span.FirstMember; Each < Span.FirstMember + Span.NumMembers; ++Each)
+			{
+				const int32 Index = Layout.SpanMembers[Each];
+				if ((*Filter)[Index])
+				{
+					const FProperty* Property = Layout.Properties[Index];
+					Builder.Update(Base + Property->GetOffset_ForInternal(), Property->GetSize());
+				}
+			}
+		}
+
+		for (const int32 Index : Layout.OtherMembers)
+		{
+			if (Filter && !(*Filter)[Index])
+			{
+				continue;
+			}
+
+			const FProperty* Property = Layout.Properties[Index];
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				HashValue(Builder, Property, Property->ContainerPtrToValuePtr<void>(Container, ArrayIndex));
+			}
+		}
+	}
+}
+
+
+namespace
+{
+	/**
+	 * TJsonReader의 토큰을 읽는 대로 멤버에 쓰는 도구
+	 */
+	class FJsonImporter
+	{
+	public:
+		explicit FJsonImporter(TJsonReader<TCHAR>& InReader)
+			: Reader(InReader)
+		{
+		}
+
+		bool ReadRoot(const UStruct* Struct, void* Container)
+		{
+			EJsonNotation Notation;
+			if (!Reader.ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+			{
+				return false;
+			}
+
+			return ReadStructBody(Struct, Container) && bTypesMatched;
+		}
+
+	private:
+		TJsonReader<TCHAR>& Reader;
+
+		/** 숫자 / bool 배열의 원소를 모아두는 버퍼, 어떤 숫자 타입으로 읽고 써도 되도록 8바이트 단위로 잡음 */
+		TArray<uint64, TInlineAllocator<32>> Scratch;
+
+		/** 타입이 맞지 않아 건너뛴 값이 있었는지 */
+		bool bTypesMatched = true;
+
+		/** 마지막으로 읽은 값 자체를 타입이 맞지 않아 건너뛰었는지 (값 안의 멤버를 건너뛴 경우는 제외) */
+		bool bValueSkipped = false;
+
+		/**
+		 * ObjectStart를 읽은 상태에서 ObjectEnd까지 읽습니다.
+		 * @return JSON이 잘못되었으면 false
+		 */
+		bool ReadStructBody(const UStruct* Struct, void* Container)
+		{
+			const auto Index = Details::FMemberNameIndex::Get(Struct);
+
+			EJsonNotation Notation;
+			while (Reader.ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ObjectEnd)
+				{
+					return true;
+				}
+
+				// 없는 이름을 FName 테이블에 추가하지 않도록 FNAME_Find로 찾음
+				const FName Name{ *Reader.GetIdentifier(), FNAME_Find };
+				const Details::FMemberNameIndex::FEntry* Entry = Name.IsNone() ? nullptr : Index->Members.Find(Name);
+
+				const bool bValid = Entry
+					? ReadMember(Notation, Entry->Property, static_cast<uint8*>(Container) + Entry->Offset)
+					: SkipValue(Notation);
+
+				if (!bValid)
+				{
+					return false;
+				}
+			}
+
+			return false;
+		}
+
+		bool ReadMember(EJsonNotation Notation, FProperty* Property, void* ValuePtr)
+		{
+			if (Property->ArrayDim == 1)
+			{
+				return ReadValue(Notation, Property, ValuePtr);
+			}
+
+			// 고정 크기 배열 멤버는 JSON 배열로 받음
+			if (Notation != EJsonNotation::ArrayStart)
+			{
+				return Mismatch(Notation);
+			}
+
+			for (int32 ArrayIndex = 0; Reader.ReadNext(Notation); ++ArrayIndex)
+			{
+				if (Notation == EJsonNotation::ArrayEnd)
+				{
+					return true;
+				}
+
+				const bool bValid = ArrayIndex < Property->ArrayDim
+					? ReadValue(Notation, Property, static_cast<uint8*>(ValuePtr) + ArrayIndex * Property->GetSize() / Property->ArrayDim)
+					: Mismatch(Notation);
+
+				if (!bValid)
+				{
+					return false;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		 * 이미 읽은 토큰 Notation에 해당하는 값을 ValuePtr에 씁니다. Property는 ArrayDim이 1이라고 가정합니다.
+		 * @return JSON이 잘못되었으면 false (타입이 맞지 않는 값은 건너뛰고 true)
+		 */
+		bool ReadValue(EJsonNotation Notation, FProperty* Property, void* ValuePtr)
+		{
+			switch (Notation)
+			{
+			case EJsonNotation::Boolean:
+				return WriteBool(Property, ValuePtr, Reader.GetValueAsBoolean()) || Mismatch(Notation);
+
+			case EJsonNotation::Number:
+				return WriteNumber(Property, ValuePtr, Reader.GetValueAsNumber()) || Mismatch(Notation);
+
+			case EJsonNotation::String:
+				return WriteString(Property, ValuePtr, Reader.GetValueAsString()) || Mismatch(Notation);
+
+			case EJsonNotation::Null:
+				WriteNull(Property, ValuePtr);
+				return true;
+
+			case EJsonNotation::ObjectStart:
+				if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+				{
+					return EndNestedValue(ReadStructBody(StructProperty->Struct, ValuePtr));
+				}
+				if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+				{
+					return EndNestedValue(ReadMap(MapProperty, ValuePtr));
+				}
+				return Mismatch(Notation);
+
+			case EJsonNotation::ArrayStart:
+				if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+				{
+					return EndNestedValue(ReadArray(ArrayProperty, ValuePtr));
+				}
+				if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+				{
+					return EndNestedValue(ReadSet(SetProperty, ValuePtr));
+				}
+				return Mismatch(Notation);
+
+			default:
+				return false;
+			}
+		}
+
+		static bool WriteBool(FProperty* Property, void* ValuePtr, bool bValue)
+		{
+			if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				// bitfield bool도 처리됨
+				BoolProperty->SetPropertyValue(ValuePtr, bValue);
+				return true;
+			}
+			return false;
+		}
+
+		/**
+		 * Value를 NumBits 비트 정수로 바꿔도 잘리거나 정의되지 않은 동작이 일어나지 않는지 검사합니다.
+		 * NaN은 모든 비교가 false이므로 여기서 걸러집니다.
+		 */
+		static bool IsIntegerInRange(double Value, int32 NumBits, bool bSigned)
+		{
+			const double Limit = FMath::Pow(2., static_cast<double>(bSigned ? NumBits - 1 : NumBits));
+			return Value >= (bSigned ? -Limit : 0.) && Value < Limit;
+		}
+
+		static bool IsIntegerInRange(double Value, const FNumericProperty* Property)
+		{
+			const bool bSigned = !(Property->IsA<FByteProperty>() || Property->IsA<FUInt16Property>() || Property->IsA<FUInt32Property>() || Property->IsA<FUInt64Property>());
+			return IsIntegerInRange(Value, Property->GetSize() / Property->ArrayDim * 8, bSigned);
+		}
+
+		static bool WriteNumber(FProperty* Property, void* ValuePtr, double Value)
+		{
+			// 가장 흔한 타입들을 먼저 확인 (원소가 없는 타입이므로 시그니처 캐시를 거치지 않고 FProperty 타입만 봐도 됨)
+			// 정수 멤버에 범위를 벗어나는 값이나 NaN이 오면 타입이 맞지 않는 값으로 취급
+			if (Property->IsA<FIntProperty>())
+			{
+				if (!IsIntegerInRange(Value, 32, true))
+				{
+					return false;
+				}
+				*static_cast<int32*>(ValuePtr) = static_cast<int32>(Value);
+				return true;
+			}
+			if (Property->IsA<FFloatProperty>())
+			{
+				*static_cast<float*>(ValuePtr) = static_cast<float>(Value);
+				return true;
+			}
+			if (Property->IsA<FInt16Property>())
+			{
+				if (!IsIntegerInRange(Value, 16, true))
+				{
+					return false;
+				}
+				*static_cast<int16*>(ValuePtr) = static_cast<int16>(Value);
+				return true;
+			}
+
+			if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				const FNumericProperty* UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+				if (!IsIntegerInRange(Value, UnderlyingProperty))
+				{
+					return false;
+				}
+				UnderlyingProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(Value));
+				return true;
+			}
+
+			if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+			{
+				if (NumericProperty->IsFloatingPoint())
+				{
+					NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Value);
+					return true;
+				}
+
+				if (!IsIntegerInRange(Value, NumericProperty))
+				{
+					return false;
+				}
+
+				// uint64의 상위 절반은 int64로 바꿀 수 없음
+				if (Value >= 0x1p63)
+				{
+					NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<uint64>(Value));
+				}
+				else
+				{
+					NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(Value));
+				}
+				return true;
+			}
+
+			return false;
+		}
+
+		static bool WriteString(FProperty* Property, void* ValuePtr, const FString& Value)
+		{
+			if (Property->IsA<FStrProperty>())
+			{
+				*static_cast<FString*>(ValuePtr) = Value;
+				return true;
+			}
+
+			if (CastField<FNameProperty>(Property))
+			{
+				*static_cast<FName*>(ValuePtr) = FName{ *Value };
+				return true;
+			}
+
+			if (CastField<FTextProperty>(Property))
+			{
+				*static_cast<FText*>(ValuePtr) = FText::FromString(Value);
+				return true;
+			}
+
+			const UEnum* Enum = nullptr;
+			const FNumericProperty* UnderlyingProperty = nullptr;
+			if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				Enum = EnumProperty->GetEnum();
+				UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+			}
+			else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property); ByteProperty && ByteProperty->Enum)
+			{
+				Enum = ByteProperty->Enum;
+				UnderlyingProperty = ByteProperty;
+			}
+
+			if (Enum)
+			{
+				const int64 EnumValue = Enum->GetValueByNameString(Value);
+				if (EnumValue == INDEX_NONE)
+				{
+					return false;
+				}
+
+				UnderlyingProperty->SetIntPropertyValue(ValuePtr, EnumValue);
+				return true;
+			}
+
+			if (Property->IsA<FSoftObjectProperty>())
+			{
+				// 로드하지 않고 경로만 씀 (FSoftClassProperty 포함)
+				*static_cast<FSoftObjectPtr*>(ValuePtr) = FSoftObjectPath{ Value };
+				return true;
+			}
+
+			if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				// 이미 메모리에 있는 객체만 찾음
+				UObject* Object = FSoftObjectPath{ Value }.ResolveObject();
+				if (!Object || !Object->IsA(ObjectProperty->PropertyClass))
+				{
+					return false;
+				}
+
+				ObjectProperty->SetObjectPropertyValue(ValuePtr, Object);
+				return true;
+			}
+
+			return false;
+		}
+
+		static void WriteNull(FProperty* Property, void* ValuePtr)
+		{
+			if (Property->IsA<FSoftObjectProperty>())
+			{
+				static_cast<FSoftObjectPtr*>(ValuePtr)->Reset();
+			}
+			else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				ObjectProperty->SetObjectPropertyValue(ValuePtr, nullptr);
+			}
+		}
+
+		static bool IsBulkElement(FProperty* Property)
+		{
+			if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				return BoolProperty->IsNativeBool();
+			}
+			return Property->IsA<FNumericProperty>() && !CastField<FNumericProperty>(Property)->IsEnum();
+		}
+
+		bool ReadArray(const FArrayProperty* ArrayProperty, void* ValuePtr)
+		{
+			FScriptArrayHelper Helper{ ArrayProperty, ValuePtr };
+			FProperty* Inner = ArrayProperty->Inner;
+
+			EJsonNotation Notation;
+
+			// 타입이 맞지 않아 건너뛴 원소는 기본값으로 남기지 않고 다시 제거함
+			if (!IsBulkElement(Inner))
+			{
+				Helper.EmptyValues();
+				while (Reader.ReadNext(Notation))
+				{
+					if (Notation == EJsonNotation::ArrayEnd)
+					{
+						return true;
+					}
+
+					const int32 Last = Helper.AddValue();
+					bValueSkipped = false;
+					if (!ReadValue(Notation, Inner, Helper.GetRawPtr(Last)))
+					{
+						return false;
+					}
+
+					if (bValueSkipped)
+					{
+						Helper.RemoveValues(Last);
+					}
+				}
+				return false;
+			}
+
+			// 원소 개수를 미리 알 수 없으므로 버퍼에 모았다가 한 번에 복사
+			// 숫자 / bool의 정렬은 8바이트를 넘지 않으므로 uint64 버퍼 안의 ElementSize 배수 위치는 항상 정렬되어 있음
+			check(Inner->GetMinAlignment() <= alignof(uint64));
+			const int32 ElementSize = Inner->GetSize();
+			int32 NumBytes = 0;
+			Scratch.Reset();
+
+			while (Reader.ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd)
+				{
+					Helper.EmptyAndAddUninitializedValues(NumBytes / ElementSize);
+					FMemory::Memcpy(Helper.GetRawPtr(), Scratch.GetData(), NumBytes);
+					return true;
+				}
+
+				if (Notation != EJsonNotation::Number && Notation != EJsonNotation::Boolean)
+				{
+					if (!Mismatch(Notation))
+					{
+						return false;
+					}
+					continue;
+				}
+
+				const int32 Offset = NumBytes;
+				NumBytes += ElementSize;
+				Scratch.SetNumUninitialized(FMath::DivideAndRoundUp(NumBytes, static_cast<int32>(sizeof(uint64))), false);
+
+				uint8* Element = reinterpret_cast<uint8*>(Scratch.GetData()) + Offset;
+				FMemory::Memzero(Element, ElementSize);
+
+				bValueSkipped = false;
+				if (!ReadValue(Notation, Inner, Element))
+				{
+					return false;
+				}
+
+				if (bValueSkipped)
+				{
+					NumBytes = Offset;
+				}
+			}
+
+			return false;
+		}
+
+		bool ReadSet(const FSetProperty* SetProperty, void* ValuePtr)
+		{
+			FScriptSetHelper Helper{ SetProperty, ValuePtr };
+			FProperty* ElementProperty = SetProperty->ElementProp;
+
+			Helper.EmptyElements();
+
+			// 중복된 원소를 걸러내기 위해 임시 원소에 읽은 뒤 추가
+			void* Element = FMemory_Alloca_Aligned(ElementProperty->GetSize(), ElementProperty->GetMinAlignment());
+
+			EJsonNotation Notation;
+			while (Reader.ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd)
+				{
+					return true;
+				}
+
+				// 타입이 맞지 않아 건너뛴 원소는 기본값으로 추가하지 않음
+				ElementProperty->InitializeValue(Element);
+				bValueSkipped = false;
+				const bool bValid = ReadValue(Notation, ElementProperty, Element);
+				if (bValid && !bValueSkipped)
+				{
+					Helper.AddElement(Element);
+				}
+				ElementProperty->DestroyValue(Element);
+
+				if (!bValid)
+				{
+					return false;
+				}
+			}
+
+			return false;
+		}
+
+		bool ReadMap(const FMapProperty* MapProperty, void* ValuePtr)
+		{
+			FScriptMapHelper Helper{ MapProperty, ValuePtr };
+			FProperty* KeyProperty = MapProperty->KeyProp;
+			FProperty* ValueProperty = MapProperty->ValueProp;
+
+			Helper.EmptyValues();
+
+			// 타입이 맞지 않는 값이 기본값으로 남거나 앞서 읽은 같은 키의 값을 덮지 않도록 임시 값에 읽은 뒤 추가
+			void* Key = FMemory_Alloca_Aligned(KeyProperty->GetSize(), KeyProperty->GetMinAlignment());
+			void* Value = FMemory_Alloca_Aligned(ValueProperty->GetSize(), ValueProperty->GetMinAlignment());
+
+			EJsonNotation Notation;
+			while (Reader.ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ObjectEnd)
+				{
+					return true;
+				}
+
+				// JSON 키는 문자열이므로 키 타입에 맞게 텍스트로 가져옴
+				KeyProperty->InitializeValue(Key);
+				const bool bKeyImported = KeyProperty->ImportText_Direct(*Reader.GetIdentifier(), Key, nullptr, PPF_None) != nullptr;
+
+				bool bValid;
+				if (bKeyImported)
+				{
+					ValueProperty->InitializeValue(Value);
+					bValueSkipped = false;
+					bValid = ReadValue(Notation, ValueProperty, Value);
+					if (bValid && !bValueSkipped)
+					{
+						Helper.AddPair(Key, Value);
+					}
+					ValueProperty->DestroyValue(Value);
+				}
+				else
+				{
+					bValid = Mismatch(Notation);
+				}
+
+				KeyProperty->DestroyValue(Key);
+
+				if (!bValid)
+				{
+					return false;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		 * 타입이 맞지 않는 값을 기록하고 건너뜁니다.
+		 */
+		bool Mismatch(EJsonNotation Notation)
+		{
+			bTypesMatched = false;
+			bValueSkipped = true;
+			return SkipValue(Notation);
+		}
+
+		/**
+		 * 구조체나 컨테이너를 다 읽은 뒤에 호출합니다.
+		 * 안에서 건너뛴 멤버나 원소가 있어도 값 자체는 읽은 것이므로 bValueSkipped를 지웁니다.
+		 */
+		bool EndNestedValue(bool bValid)
+		{
+			bValueSkipped = false;
+			return bValid;
+		}
+
+		/**
+		 * 이미 읽은 토큰 Notation에 해당하는 값을 건너뜁니다. 객체나 배열이면 짝이 맞는 끝까지 읽습니다.
+		 */
+		bool SkipValue(EJsonNotation Notation)
+		{
+			if (Notation == EJsonNotation::Error || Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
+			{
+				return false;
+			}
+
+			int32 Depth = Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart ? 1 : 0;
+			while (Depth > 0)
+			{
+				if (!Reader.ReadNext(Notation) || Notation == EJsonNotation::Error)
+				{
+					return false;
+				}
+
+				if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+				{
+					Depth++;
+				}
+				else if (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
+				{
+					Depth--;
+				}
+			}
+
+			return true;
+		}
+	};
+}
+
+
+namespace
+{
+	/**
+	 * 멤버들이 소유한 힙 메모리를 재귀적으로 집계하는 도구
+	 */
+	class FMemoryMeasurer
+	{
+	public:
+		FMemoryMeasurer(const FReflectionDeepIterationOptions& InOptions, FReflectionMemoryReport& InReport)
+			: Options(InOptions), Report(InReport)
+		{
+		}
+
+		void MeasureRoot(const UStruct* Struct, const void* Container)
+		{
+			const UObject* Owner = Struct->IsA<UClass>() ? static_cast<const UObject*>(Container) : nullptr;
+			if (Owner)
+			{
+				Visited.Add(Owner);
+			}
+
+			FReflectionMemoryUsage Own;
+			for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+			{
+				FReflectionMemoryUsage Member;
+				MeasureMember(*It, Container, Owner, 0, Own, Member);
+				Report.Members.Add({ It->GetFName(), Member });
+			}
+
+			AddToClass(Struct, Own);
+		}
+
+	private:
+		const FReflectionDeepIterationOptions& Options;
+		FReflectionMemoryReport& Report;
+		TSet<const UObject*> Visited;
+
+		void AddToClass(const UStruct* Struct, const FReflectionMemoryUsage& Own)
+		{
+			FReflectionMemoryReport::FClass& Class = Report.Classes.FindOrAdd(Struct);
+			Class.NumObjects++;
+			Class.InstanceBytes += Struct->GetStructureSize();
+			Class.Usage += Own;
+		}
+
+		/**
+		 * 객체 하나를 집계하고 객체 크기를 포함한 전체 메모리를 반환합니다.
+		 */
+		FReflectionMemoryUsage MeasureObject(const UObject* Object, int32 Depth)
+		{
+			const UClass* Class = Object->GetClass();
+
+			FReflectionMemoryUsage Own;
+			FReflectionMemoryUsage Total{ Class->GetStructureSize(), Class->GetStructureSize() };
+
+			for (TFieldIterator<FProperty> It{ Class }; It; ++It)
+			{
+				MeasureMember(*It, Object, Object, Depth, Own, Total);
+			}
+
+			AddToClass(Class, Own);
+			return Total;
+		}
+
+		void MeasureMember(const FProperty* Property, const void* Container, const UObject* Owner, int32 Depth, FReflectionMemoryUsage& Own, FReflectionMemoryUsage& Total)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				MeasureValue(Property, Property->ContainerPtrToValuePtr<void>(Container, ArrayIndex), Owner, Depth, Own, Total);
+			}
+		}
+
+		/**
+		 * 값 하나가 소유한 메모리를 Own과 Total에 더합니다. 따라간 UObject의 메모리는 Total에만 더합니다.
+		 */
+		void MeasureValue(const FProperty* Property, const void* ValuePtr, const UObject* Owner, int32 Depth, FReflectionMemoryUsage& Own, FReflectionMemoryUsage& Total)
+		{
+			const auto AddOwn = [&](int64 AllocatedBytes, int64 UsedBytes)
+			{
+				const FReflectionMemoryUsage Usage{ AllocatedBytes, UsedBytes };
+				Own += Usage;
+				Total += Usage;
+			};
+
+			if (CastField<FStrProperty>(Property))
+			{
+				const FString& String = *static_cast<const FString*>(ValuePtr);
+				AddOwn(String.GetAllocatedSize(), String.GetCharArray().Num() * sizeof(TCHAR));
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				const FScriptArray* Array = static_cast<const FScriptArray*>(ValuePtr);
+				const int32 ElementSize = ArrayProperty->Inner->GetSize();
+				AddOwn(Array->GetAllocatedSize(ElementSize), static_cast<int64>(Array->Num()) * ElementSize);
+
+				if (MayOwnMemory(ArrayProperty->Inner, Depth))
+				{
+					FScriptArrayHelper Helper{ ArrayProperty, ValuePtr };
+					for (int32 Index = 0; Index < Helper.Num(); ++Index)
+					{
+						MeasureValue(ArrayProperty->Inner, Helper.GetRawPtr(Index), Owner, Depth, Own, Total);
+					}
+				}
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+			{
+				FScriptSetHelper Helper{ SetProperty, ValuePtr };
+				const int32 ElementSize = SetProperty->SetLayout.Size;
+				AddOwn(static_cast<int64>(Helper.GetMaxIndex()) * ElementSize, static_cast<int64>(Helper.Num()) * ElementSize);
+
+				if (MayOwnMemory(SetProperty->ElementProp, Depth))
+				{
+					Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+					{
+						MeasureValue(SetProperty->ElementProp, Helper.GetElementPtr(Index), Owner, Depth, Own, Total);
+					});
+				}
+			}
+			else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+			{
+				FScriptMapHelper Helper{ MapProperty, ValuePtr };
+				const int32 PairSize = MapProperty->MapLayout.SetLayout.Size;
+				AddOwn(static_cast<int64>(Helper.GetMaxIndex()) * PairSize, static_cast<int64>(Helper.Num()) * PairSize);
+
+				const bool bKeys = MayOwnMemory(MapProperty->KeyProp, Depth);
+				const bool bValues = MayOwnMemory(MapProperty->ValueProp, Depth);
+				if (bKeys || bValues)
+				{
+					Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+					{
+						if (bKeys)
+						{
+							MeasureValue(MapProperty->KeyProp, Helper.GetKeyPtr(Index), Owner, Depth, Own, Total);
+						}
+						if (bValues)
+						{
+							MeasureValue(MapProperty->ValueProp, Helper.GetValuePtr(Index), Owner, Depth, Own, Total);
+						}
+					});
+				}
+			}
+			else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (Depth < Options.MaxDepth)
+				{
+					for (TFieldIterator<FProperty> It{ StructProperty->Struct }; It; ++It)
+					{
+						MeasureMember(*It, ValuePtr, Owner, Depth + 1, Own, Total);
+					}
+				}
+			}
+			else if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+			{
+				if (!Options.bFollowObjects || Depth >= Options.MaxDepth)
+				{
+					return;
+				}
+
+				const UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+				if (!IsValid(Object) || (Options.bOnlyOwnedObjects && Owner && !Object->IsInOuter(Owner)))
+				{
+					return;
+				}
+
+				bool bAlreadyVisited = false;
+				Visited.Add(Object, &bAlreadyVisited);
+				if (!bAlreadyVisited)
+				{
+					Total += MeasureObject(Object, Depth + 1);
+				}
+			}
+		}
+
+		/**
+		 * 컨테이너의 원소를 하나씩 확인할 필요가 있는지 여부
+		 */
+		bool MayOwnMemory(const FProperty* Property, int32 Depth) const
+		{
+			if (Property->IsA<FStructProperty>())
+			{
+				return Depth < Options.MaxDepth;
+			}
+			if (Property->IsA<FObjectProperty>())
+			{
+				return Options.bFollowObjects && Depth < Options.MaxDepth;
+			}
+			return Property->IsA<FStrProperty>() || Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>();
+		}
+	};
+
+
+	/**
+	 * UStruct 하나에서 힙 메모리를 소유할 수 있는 멤버들
+	 */
+	struct FShrinkLayout : Details::FReflectionLayout
+	{
+		TArray<const FProperty*> Properties;
+
+		explicit FShrinkLayout(const UStruct* Struct)
+		{
+			for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+			{
+				if (MayOwnMemory(*It))
+				{
+					Properties.Add(*It);
+				}
+			}
+		}
+
+		static TSharedRef<const FShrinkLayout, ESPMode::ThreadSafe> Get(const UStruct* Struct)
+		{
+			return Details::FReflectionLayoutCache::Get().FindOrAdd<FShrinkLayout>(Struct);
+		}
+
+		static bool MayOwnMemory(const FProperty* Property)
+		{
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				return !Get(StructProperty->Struct)->Properties.IsEmpty();
+			}
+			return Property->IsA<FStrProperty>() || Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>();
+		}
+	};
+
+	int64 ShrinkStruct(const FShrinkLayout& Layout, void* Container);
+
+	/**
+	 * TSet / TMap에 구멍이 있으면 빈틈 없는 복사본을 만들어 원본과 바꿉니다.
+	 * 리플렉션 되는 TSet / TMap은 기본 Allocator를 쓰므로 메모리를 통째로 바꿔도 안전합니다.
+	 */
+	void CompactSparse(const FProperty* Property, void* ValuePtr)
+	{
+		void* Compacted = FMemory_Alloca_Aligned(Property->GetSize(), Property->GetMinAlignment());
+
+		// 복사할 때 원소 개수만큼만 예약됨
+		Property->InitializeValue(Compacted);
+		Property->CopySingleValue(Compacted, ValuePtr);
+
+		FMemory::Memswap(Compacted, ValuePtr, Property->GetSize());
+		Property->DestroyValue(Compacted);
+	}
+
+	/**
+	 * 값 하나를 Shrink 하고 회수한 바이트 수를 반환합니다. Property는 ArrayDim이 1이라고 가정합니다.
+	 */
+	int64 ShrinkValue(const FProperty* Property, void* ValuePtr)
+	{
+		if (CastField<FStrProperty>(Property))
+		{
+			FString& String = *static_cast<FString*>(ValuePtr);
+
+			const int64 Before = String.GetAllocatedSize();
+			String.Shrink();
+			return Before - String.GetAllocatedSize();
+		}
+
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			const FProperty* Inner = ArrayProperty->Inner;
+			FScriptArray* Array = static_cast<FScriptArray*>(ValuePtr);
+
+			int64 Reclaimed = 0;
+			if (FShrinkLayout::MayOwnMemory(Inner))
+			{
+				FScriptArrayHelper Helper{ ArrayProperty, ValuePtr };
+				for (int32 Index = 0; Index < Helper.Num(); ++Index)
+				{
+					Reclaimed += ShrinkValue(Inner, Helper.GetRawPtr(Index));
+				}
+			}
+
+			const int32 ElementSize = Inner->GetSize();
+			const int64 Before = Array->GetAllocatedSize(ElementSize);
+			Array->Shrink(ElementSize, Inner->GetMinAlignment());
+			return Reclaimed + Before - Array->GetAllocatedSize(ElementSize);
+		}
+
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			const int32 ElementSize = SetProperty->SetLayout.Size;
+
+			FScriptSetHelper Before{ SetProperty, ValuePtr };
+			const int64 BeforeBytes = static_cast<int64>(Before.GetMaxIndex()) * ElementSize;
+			if (Before.GetMaxIndex() != Before.Num())
+			{
+				CompactSparse(Property, ValuePtr);
+			}
+
+			FScriptSetHelper After{ SetProperty, ValuePtr };
+			int64 Reclaimed = BeforeBytes - static_cast<int64>(After.GetMaxIndex()) * ElementSize;
+
+			if (FShrinkLayout::MayOwnMemory(SetProperty->ElementProp))
+			{
+				Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+				{
+					Reclaimed += ShrinkValue(SetProperty->ElementProp, After.GetElementPtr(Index));
+				});
+			}
+			return Reclaimed;
+		}
+
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			const int32 PairSize = MapProperty->MapLayout.SetLayout.Size;
+
+			FScriptMapHelper Before{ MapProperty, ValuePtr };
+			const int64 BeforeBytes = static_cast<int64>(Before.GetMaxIndex()) * PairSize;
+			if (Before.GetMaxIndex() != Before.Num())
+			{
+				CompactSparse(Property, ValuePtr);
+			}
+
+			FScriptMapHelper After{ MapProperty, ValuePtr };
+			int64 Reclaimed = BeforeBytes - static_cast<int64>(After.GetMaxIndex()) * PairSize;
+
+			// 키를 바꾸면 해시가 달라질 수 있으므로 값만 Shrink
+			if (FShrinkLayout::MayOwnMemory(MapProperty->ValueProp))
+			{
+				Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+				{
+					Reclaimed += ShrinkValue(MapProperty->ValueProp, After.GetValuePtr(Index));
+				});
+			}
+			return Reclaimed;
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return ShrinkStruct(*FShrinkLayout::Get(StructProperty->Struct), ValuePtr);
+		}
+
+		return 0;
+	}
+
+	int64 ShrinkStruct(const FShrinkLayout& Layout, void* Container)
+	{
+		int64 Reclaimed = 0;
+		for (const FProperty* Property : Layout.Properties)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				Reclaimed += ShrinkValue(Property, Property->ContainerPtrToValuePtr<void>(Container, ArrayIndex));
+			}
+		}
+		return Reclaimed;
+	}
+
+
+	void MeasureMemoryOfClass(const TArray<FString>& Args)
+	{
+		if (Args.IsEmpty())
+		{
+			UE_LOG(LogReflectionHelper, Display, TEXT("Usage: ReflectionHelper.MeasureMemory <ClassName> [MaxDepth]"));
+			return;
+		}
+
+		const UClass* Class = UClass::TryFindTypeSlow<UClass>(Args[0]);
+		if (!Class)
+		{
+			UE_LOG(LogReflectionHelper, Warning, TEXT("Class %s not found"), *Args[0]);
+			return;
+		}
+
+		FReflectionDeepIterationOptions Options;
+		if (Args.Num() > 1)
+		{
+			LexFromString(Options.MaxDepth, *Args[1]);
+		}
+
+		// 파생 클래스는 멤버가 다를 수 있으므로 멤버는 이름으로 합침
+		TMap<FName, FReflectionMemoryUsage> Members;
+		TMap<const UStruct*, FReflectionMemoryReport::FClass> Classes;
+
+		ForEachObjectOfClass(Class, [&](UObject* Object)
+		{
+			FReflectionMemoryReport Report;
+			Details::MeasureMemory(Object->GetClass(), Object, Options, Report);
+
+			for (const FReflectionMemoryReport::FMember& Member : Report.Members)
+			{
+				Members.FindOrAdd(Member.Name) += Member.Usage;
+			}
+
+			for (const TPair<const UStruct*, FReflectionMemoryReport::FClass>& Each : Report.Classes)
+			{
+				FReflectionMemoryReport::FClass& Aggregated = Classes.FindOrAdd(Each.Key);
+				Aggregated.NumObjects += Each.Value.NumObjects;
+				Aggregated.InstanceBytes += Each.Value.InstanceBytes;
+				Aggregated.Usage += Each.Value.Usage;
+			}
+		});
+
+		UE_LOG(LogReflectionHelper, Display, TEXT("Memory of %s instances (MaxDepth=%d)"), *Class->GetName(), Options.MaxDepth);
+		UE_LOG(LogReflectionHelper, Display, TEXT("%-40s %8s %14s %14s %14s %14s"), TEXT("Class"), TEXT("Count"), TEXT("Instance"), TEXT("Allocated"), TEXT("Used"), TEXT("Slack"));
+
+		Classes.ValueSort([](const FReflectionMemoryReport::FClass& Left, const FReflectionMemoryReport::FClass& Right)
+		{
+			return Left.Usage.AllocatedBytes + Left.InstanceBytes > Right.Usage.AllocatedBytes + Right.InstanceBytes;
+		});
+
+		for (const TPair<const UStruct*, FReflectionMemoryReport::FClass>& Each : Classes)
+		{
+			UE_LOG(LogReflectionHelper, Display, TEXT("%-40s %8d %14lld %14lld %14lld %14lld"),
+				*Each.Key->GetName(), Each.Value.NumObjects, Each.Value.InstanceBytes,
+				Each.Value.Usage.AllocatedBytes, Each.Value.Usage.UsedBytes, Each.Value.Usage.GetSlackBytes());
+		}
+
+		UE_LOG(LogReflectionHelper, Display, TEXT("%-40s %14s %14s %14s"), TEXT("Member"), TEXT("Allocated"), TEXT("Used"), TEXT("Slack"));
+
+		Members.ValueSort([](const FReflectionMemoryUsage& Left, const FReflectionMemoryUsage& Right)
+		{
+			return Left.GetSlackBytes() > Right.GetSlackBytes();
+		});
+
+		for (const TPair<FName, FReflectionMemoryUsage>& Each : Members)
+		{
+			if (Each.Value.AllocatedBytes > 0)
+			{
+				UE_LOG(LogReflectionHelper, Display, TEXT("%-40s %14lld %14lld %14lld"),
+					*Each.Key.ToString(), Each.Value.AllocatedBytes, Each.Value.UsedBytes, Each.Value.GetSlackBytes());
+			}
+		}
+	}
+
+	FAutoConsoleCommand MeasureMemoryCommand{
+		TEXT("ReflectionHelper.MeasureMemory"),
+		TEXT("Aggregates allocated vs used bytes of reflected members over all live instances of a class. Usage: ReflectionHelper.MeasureMemory <ClassName> [MaxDepth]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&MeasureMemoryOfClass)
+	};
+}
+
+
+namespace
+{
+	/**
+	 * UStruct의 모든 bool 멤버를 (바이트, 마스크) 묶음으로 정리한 것
+	 * 같은 바이트 안의 이어진 비트필드들이 선언 순서대로 놓여 있으면 하나의 묶음이 되어 한 번의 마스크 연산으로 옮겨집니다.
+	 */
+	struct FBoolMaskLayout : Details::FReflectionLayout
+	{
+		struct FRun
+		{
+			uint32 ByteOffset;
+
+			/** 바이트 안에서 묶음이 차지하는 비트들 */
+			uint8 FieldMask;
+
+			/** FieldMask의 가장 낮은 비트 위치 */
+			uint8 Shift;
+
+			uint8 NumBits;
+
+			/** 결과 마스크에서 묶음의 첫 비트 위치 */
+			int32 FirstBit;
+		};
+
+		TArray<FRun> Runs;
+		int32 NumBools = 0;
+
+		explicit FBoolMaskLayout(const UStruct* Struct)
+		{
+			for (TFieldIterator<FBoolProperty> It{ Struct }; It; ++It)
+			{
+				const uint32 ByteOffset = static_cast<uint32>(It->GetOffset_ForInternal() + It->GetByteOffset());
+
+				// native bool은 0 또는 1로 저장되므로 최하위 비트만 옮겨도 됨
+				const uint8 FieldMask = It->IsNativeBool() ? 1 : It->GetFieldMask();
+				const uint8 Shift = static_cast<uint8>(FMath::CountTrailingZeros(static_cast<uint32>(FieldMask)));
+
+				FRun* Last = Runs.IsEmpty() ? nullptr : &Runs.Last();
+				if (Last && !It->IsNativeBool() && Last->ByteOffset == ByteOffset && Last->Shift + Last->NumBits == Shift)
+				{
+					Last->FieldMask |= FieldMask;
+					Last->NumBits++;
+				}
+				else
+				{
+					Runs.Add({ ByteOffset, FieldMask, Shift, 1, NumBools });
+				}
+
+				NumBools++;
+			}
+		}
+
+		static TSharedRef<const FBoolMaskLayout, ESPMode::ThreadSafe> Get(const UStruct* Struct)
+		{
+			return Details::FReflectionLayoutCache::Get().FindOrAdd<FBoolMaskLayout>(Struct);
+		}
+	};
+}
+
+
+namespace
+{
+	/**
+	 * UStruct 하나에서 따라가야 할 UObject 참조 멤버들
+	 * 구조체 멤버는 오프셋이 고정되어 있으므로 그 안의 참조는 바깥 UStruct 기준의 오프셋으로 평탄화하고,
+	 * 원소 수가 변하는 TArray, TSet, TMap은 참조를 담을 수 있는 것만 따로 둡니다.
+	 */
+	struct FReferenceLayout : Details::FReflectionLayout
+	{
+		struct FContainer
+		{
+			uint32 Offset;
+			const FProperty* Property;
+
+			/** TMap일 때 키와 값 중 참조를 담을 수 있는 쪽, 탐색 중에 매번 구하지 않도록 미리 구해 둠 */
+			bool bScanKeys = false;
+			bool bScanValues = false;
+		};
+
+		TArray<uint32> ObjectOffsets;
+
+		/** TScriptInterface 멤버, 객체는 FScriptInterface::GetObject로 읽음 */
+		TArray<uint32> InterfaceOffsets;
+
+		TArray<FContainer> Containers;
+
+		explicit FReferenceLayout(const UStruct* Struct)
+		{
+			AddMembers(Struct, 0);
+		}
+
+		static bool MayContainReferences(const FProperty* Property)
+		{
+			TSet<const UStruct*> VisitedStructs;
+			return MayContainReferences(Property, VisitedStructs);
+		}
+
+	private:
+		/**
+		 * @param VisitedStructs TArray<자기 자신>을 가진 구조체처럼 순환하는 구조체를 한 번만 살펴보기 위한 집합
+		 */
+		static bool MayContainReferences(const FProperty* Property, TSet<const UStruct*>& VisitedStructs)
+		{
+			// FInterfaceProperty는 ContainsObjectReference로 드러나지 않으므로 구조체와 컨테이너 안까지 직접 찾음
+			if (Property->IsA<FInterfaceProperty>())
+			{
+				return true;
+			}
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				// 이미 살펴본 구조체에 참조가 있었다면 그때 true가 반환되었을 것이므로 다시 볼 필요 없음
+				bool bAlreadyVisited = false;
+				VisitedStructs.Add(StructProperty->Struct, &bAlreadyVisited);
+				if (bAlreadyVisited)
+				{
+					return false;
+				}
+
+				for (TFieldIterator<FProperty> It{ StructProperty->Struct }; It; ++It)
+				{
+					if (MayContainReferences(*It, VisitedStructs))
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				return MayContainReferences(ArrayProperty->Inner, VisitedStructs);
+			}
+			if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+			{
+				return MayContainReferences(SetProperty->ElementProp, VisitedStructs);
+			}
+			if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+			{
+				return MayContainReferences(MapProperty->KeyProp, VisitedStructs) || MayContainReferences(MapProperty->ValueProp, VisitedStructs);
+			}
+
+			TArray<const FStructProperty*> EncounteredStructProps;
+			return Property->ContainsObjectReference(EncounteredStructProps, EPropertyObjectReferenceType::Strong);
+		}
+
+		void AddMembers(const UStruct* Struct, uint32 BaseOffset)
+		{
+			for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+			{
+				if (!MayContainReferences(*It))
+				{
+					continue;
+				}
+
+				const uint32 ElementSize = static_cast<uint32>(It->GetSize() / It->ArrayDim);
+				for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+				{
+					const uint32 Offset = BaseOffset + static_cast<uint32>(It->GetOffset_ForInternal()) + ArrayIndex * ElementSize;
+
+					// Weak, Lazy, Soft 참조는 FObjectProperty가 아니므로 여기서 걸러짐
+					if (It->IsA<FObjectProperty>())
+					{
+						ObjectOffsets.Add(Offset);
+					}
+					else if (It->IsA<FInterfaceProperty>())
+					{
+						InterfaceOffsets.Add(Offset);
+					}
+					else if (const FStructProperty* StructProperty = CastField<FStructProperty>(*It))
+					{
+						AddMembers(StructProperty->Struct, Offset);
+					}
+					else if (const FMapProperty* MapProperty = CastField<FMapProperty>(*It))
+					{
+						Containers.Add({ Offset, *It, MayContainReferences(MapProperty->KeyProp), MayContainReferences(MapProperty->ValueProp) });
+					}
+					else if (It->IsA<FArrayProperty>() || It->IsA<FSetProperty>())
+					{
+						Containers.Add({ Offset, *It });
+					}
+				}
+			}
+		}
+	};
+
+	/**
+	 * 탐색 한 번 동안 공유되는 방문 여부 비트셋
+	 * GUObjectArray 인덱스로 접근하며, 탐색 도중 인덱스 범위 밖에 생성된 객체는 락으로 보호되는 집합에 기록합니다.
+	 */
+	class FVisitedObjects
+	{
+	public:
+		FVisitedObjects()
+			: NumWords((GUObjectArray.GetObjectArrayNum() + 63) / 64)
+			, Words(MakeUnique<std::atomic<uint64>[]>(NumWords))
+		{
+			for (int32 i = 0; i < NumWords; ++i)
+			{
+				Words[i].store(0, std::memory_order_relaxed);
+			}
+		}
+
+		/**
+		 * @return 처음 방문하는 객체이면 true
+		 */
+		bool TryMark(const UObject* Object)
+		{
+			const int32 Index = GUObjectArray.ObjectToIndex(Object);
+			const int32 WordIndex = Index / 64;
+
+			if (WordIndex < NumWords)
+			{
+				const uint64 Bit = 1ull << (Index % 64);
+				return (Words[WordIndex].fetch_or(Bit, std::memory_order_relaxed) & Bit) == 0;
+			}
+
+			FScopeLock ScopeLock{ &OverflowLock };
+			bool bAlreadyInSet = false;
+			Overflow.Add(Object, &bAlreadyInSet);
+			return !bAlreadyInSet;
+		}
+
+	private:
+		int32 NumWords;
+		TUniquePtr<std::atomic<uint64>[]> Words;
+
+		FCriticalSection OverflowLock;
+		TSet<const UObject*> Overflow;
+	};
+
+	using FReferenceLayoutMap = TMap<const UStruct*, TSharedRef<const FReferenceLayout, ESPMode::ThreadSafe>>;
+
+	/**
+	 * 워커 스레드 하나가 frontier의 일부를 처리하면서 다음 frontier를 모으는 곳
+	 * Layout은 워커 별로 한 번만 캐시에서 가져오므로 원소마다 캐시의 락을 잡지 않습니다.
+	 * ParallelForWithTaskContext는 호출마다 워커를 새로 만들므로 Layouts는 탐색이 끝날 때까지 유지되는 바깥의 맵을 가리킵니다.
+	 */
+	struct FReachabilityWorker
+	{
+		FVisitedObjects* Visited;
+		FReferenceLayoutMap* Layouts;
+		TArray<UObject*> Found;
+
+		FReachabilityWorker(FVisitedObjects& InVisited, FReferenceLayoutMap& InLayouts)
+			: Visited(&InVisited)
+			, Layouts(&InLayouts)
+		{
+		}
+
+		const FReferenceLayout& GetLayout(const UStruct* Struct)
+		{
+			if (const auto* Cached = Layouts->Find(Struct))
+			{
+				return **Cached;
+			}
+
+			return *Layouts->Add(Struct, Details::FReflectionLayoutCache::Get().FindOrAdd<FReferenceLayout>(Struct));
+		}
+
+		void AddObject(UObject* Object)
+		{
+			if (IsValid(Object) && Visited->TryMark(Object))
+			{
+				Found.Add(Object);
+			}
+		}
+
+		void AddObject(const uint8* ValuePtr)
+		{
+			Details::ResolveIfRawObjectPointer<UObject*>(ValuePtr);
+			AddObject(*reinterpret_cast<UObject* const*>(ValuePtr));
+		}
+
+		void AddInterface(const uint8* ValuePtr)
+		{
+			AddObject(reinterpret_cast<const FScriptInterface*>(ValuePtr)->GetObject());
+		}
+
+		void ScanStruct(const FReferenceLayout& Layout, const uint8* Base)
+		{
+			for (const uint32 Offset : Layout.ObjectOffsets)
+			{
+				AddObject(Base + Offset);
+			}
+
+			for (const uint32 Offset : Layout.InterfaceOffsets)
+			{
+				AddInterface(Base + Offset);
+			}
+
+			for (const FReferenceLayout::FContainer& Each : Layout.Containers)
+			{
+				if (const FMapProperty* MapProperty = CastField<FMapProperty>(Each.Property))
+				{
+					ScanMap(MapProperty, Base + Each.Offset, Each.bScanKeys, Each.bScanValues);
+				}
+				else
+				{
+					ScanValue(Each.Property, Base + Each.Offset);
+				}
+			}
+		}
+
+		void ScanValue(const FProperty* Property, const uint8* ValuePtr)
+		{
+			if (Property->IsA<FObjectProperty>())
+			{
+				AddObject(ValuePtr);
+			}
+			else if (Property->IsA<FInterfaceProperty>())
+			{
+				AddInterface(ValuePtr);
+			}
+			else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				ScanStruct(GetLayout(StructProperty->Struct), ValuePtr);
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				const FScriptArray* Array = reinterpret_cast<const FScriptArray*>(ValuePtr);
+				const uint8* Elements = static_cast<const uint8*>(Array->GetData());
+				const int32 ElementSize = ArrayProperty->Inner->GetSize();
+
+				// TArray<UObject*>는 가장 흔하므로 Property 검사 없이 바로 읽음
+				if (ArrayProperty->Inner->IsA<FObjectProperty>())
+				{
+					for (int32 i = 0; i < Array->Num(); ++i)
+					{
+						AddObject(Elements + i * ElementSize);
+					}
+				}
+				else
+				{
+					for (int32 i = 0; i < Array->Num(); ++i)
+					{
+						ScanValue(ArrayProperty->Inner, Elements + i * ElementSize);
+					}
+				}
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+			{
+				FScriptSetHelper Helper{ SetProperty, ValuePtr };
+				Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+				{
+					ScanValue(SetProperty->ElementProp, Helper.GetElementPtr(Index));
+				});
+			}
+			// 컨테이너 안에 컨테이너를 둘 수 없으므로 TMap은 Layout의 Containers에서만 오고 ScanMap이 처리함
+		}
+
+		void ScanMap(const FMapProperty* MapProperty, const uint8* ValuePtr, bool bScanKeys, bool bScanValues)
+		{
+			FScriptMapHelper Helper{ MapProperty, ValuePtr };
+			Details::ForEachValidIndex(ValuePtr, [&](int32 Index)
+			{
+				if (bScanKeys)
+				{
+					ScanValue(MapProperty->KeyProp, Helper.GetKeyPtr(Index));
+				}
+				if (bScanValues)
+				{
+					ScanValue(MapProperty->ValueProp, Helper.GetValuePtr(Index));
+				}
+			});
+		}
+	};
+}
+
+
+namespace Details
+{
+	FPodSpanLayout::FPodSpanLayout(const UStruct* Struct)
+	{
+		for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+		{
+			Properties.Add(*It);
+		}
+
+		TArray<int32> ByOffset;
+		ByOffset.Reserve(Properties.Num());
+		for (int32 Index = 0; Index < Properties.Num(); ++Index)
+		{
+			ByOffset.Add(Index);
+		}
+
+		ByOffset.StableSort([&](int32 Left, int32 Right)
+		{
+			return Properties[Left]->GetOffset_ForInternal() < Properties[Right]->GetOffset_ForInternal();
+		});
+
+		for (const int32 Index : ByOffset)
+		{
+			const FProperty* Property = Properties[Index];
+			if (!IsPlainOldData(Property))
+			{
+				OtherMembers.Add(Index);
+				continue;
+			}
+
+			const uint32 Offset = static_cast<uint32>(Property->GetOffset_ForInternal());
+			const uint32 Size = static_cast<uint32>(Property->GetSize());
+
+			// 바로 앞 Span과 빈틈 없이 맞닿아 있을 때만 합침 (패딩은 초기화되지 않았을 수 있으므로 덮지 않음)
+			if (Spans.IsEmpty() || Spans.Last().Offset + Spans.Last().Size != Offset)
+			{
+				Spans.Add({ Offset, 0, SpanMembers.Num(), 0 });
+			}
+
+			Spans.Last().Size += Size;
+			Spans.Last().NumMembers++;
+			SpanMembers.Add(Index);
+		}
+	}
+
+	bool FPodSpanLayout::IsPlainOldData(const FProperty* Property)
+	{
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			return BoolProperty->IsNativeBool();
+		}
+
+		if (Property->IsA<FNameProperty>())
+		{
+			return false;
+		}
+
+		// UObject*, TObjectPtr, Weak / Lazy / Soft 포인터, 인터페이스, 델리게이트, 필드 경로는 CPF_IsPlainOldData가 붙어 있어도
+		// 주소나 GUObjectArray 인덱스를 담고 있으므로 프로세스가 바뀌거나 객체가 파괴되면 의미가 없어짐
+		if (Property->IsA<FObjectPropertyBase>()
+			|| Property->IsA<FInterfaceProperty>()
+			|| Property->IsA<FDelegateProperty>()
+			|| Property->IsA<FMulticastDelegateProperty>()
+			|| Property->IsA<FFieldPathProperty>())
+		{
+			return false;
+		}
+
+		return Property->HasAnyPropertyFlags(CPF_IsPlainOldData);
+	}
+
+	TBitArray<> Diff(const UStruct* Struct, const void* A, const void* B, const TBitArray<>* Filter)
+	{
+		const auto Layout = FPodSpanLayout::Get(Struct);
+		const uint8* const BaseA = static_cast<const uint8*>(A);
+		const uint8* const BaseB = static_cast<const uint8*>(B);
+
+		TBitArray<> Result{ false, Layout->Properties.Num() };
+
+		for (const FPodSpanLayout::FSpan& Span : Layout->Spans)
+		{
+			// 대부분의 구간은 같을 것이므로 구간 전체를 먼저 비교
+			if (FMemory::Memcmp(BaseA + Span.Offset, BaseB + Span.Offset, Span.Size) == 0)
+			{
+				continue;
+			}
+
+			for (int32 Each = Span.FirstMember; Each < Span.FirstMember + Span.NumMembers; ++Each)
+			{
+				const int32 Index = Layout->SpanMembers[Each];
+				if (Filter && !(*Filter)[Index])
+				{
+					continue;
+				}
+
+				const FProperty* Property = Layout->Properties[Index];
+				const int32 Offset = Property->GetOffset_ForInternal();
+				if (FMemory::Memcmp(BaseA + Offset, BaseB + Offset, Property->GetSize()) != 0)
+				{
+					Result[Index] = true;
+				}
+			}
+		}
+
+		for (const int32 Index : Layout->OtherMembers)
+		{
+			if (Filter && !(*Filter)[Index])
+			{
+				continue;
+			}
+
+			const FProperty* Property = Layout->Properties[Index];
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				if (!Property->Identical(Property->ContainerPtrToValuePtr<void>(A, ArrayIndex), Property->ContainerPtrToValuePtr<void>(B, ArrayIndex), PPF_None))
+				{
+					Result[Index] = true;
+					break;
+				}
+			}
+		}
+
+		return Result;
+	}
+
+	uint64 HashMembers(const UStruct* Struct, const void* Container, const TBitArray<>* Filter)
+	{
+		FXxHash64Builder Builder;
+		HashStruct(Builder, *FPodSpanLayout::Get(Struct), Container, Filter);
+		return Builder.Finalize().Hash;
+	}
+
+	void ReadBoolMask(const UStruct* Struct, const void* Container, TBitArray<>& OutMask)
+	{
+		const auto Layout = FBoolMaskLayout::Get(Struct);
+		const uint8* Base = static_cast<const uint8*>(Container);
+
+		OutMask.Init(false, Layout->NumBools);
+		uint32* Words = OutMask.GetData();
+
+		for (const FBoolMaskLayout::FRun& Run : Layout->Runs)
+		{
+			const uint32 Bits = static_cast<uint32>(Base[Run.ByteOffset] & Run.FieldMask) >> Run.Shift;
+			const int32 WordIndex = Run.FirstBit / NumBitsPerDWORD;
+			const int32 BitIndex = Run.FirstBit % NumBitsPerDWORD;
+
+			Words[WordIndex] |= Bits << BitIndex;
+
+			// 묶음이 워드 경계에 걸친 경우
+			if (BitIndex + Run.NumBits > NumBitsPerDWORD)
+			{
+				Words[WordIndex + 1] |= Bits >> (NumBitsPerDWORD - BitIndex);
+			}
+		}
+	}
+
+	bool WriteBoolMask(const UStruct* Struct, void* Container, const TBitArray<>& Mask)
+	{
+		const auto Layout = FBoolMaskLayout::Get(Struct);
+		if (Mask.Num() != Layout->NumBools)
+		{
+			return false;
+		}
+
+		uint8* Base = static_cast<uint8*>(Container);
+		const uint32* Words = Mask.GetData();
+
+		for (const FBoolMaskLayout::FRun& Run : Layout->Runs)
+		{
+			const int32 WordIndex = Run.FirstBit / NumBitsPerDWORD;
+			const int32 BitIndex = Run.FirstBit % NumBitsPerDWORD;
+
+			uint32 Bits = Words[WordIndex] >> BitIndex;
+			if (BitIndex + Run.NumBits > NumBitsPerDWORD)
+			{
+				Bits |= Words[WordIndex + 1] << (NumBitsPerDWORD - BitIndex);
+			}
+			Bits &= (1u << Run.NumBits) - 1;
+
+			uint8& Byte = Base[Run.ByteOffset];
+			Byte = static_cast<uint8>((Byte & ~Run.FieldMask) | (Bits << Run.Shift));
+		}
+
+		return true;
+	}
+
+	bool ReadJson(const UStruct* Struct, void* Container, TJsonReader<TCHAR>& Reader)
+	{
+		return FJsonImporter{ Reader }.ReadRoot(Struct, Container);
+	}
+
+	int64 ShrinkMembers(TConstArrayView<TPair<const UStruct*, void*>> Containers)
+	{
+		std::atomic<int64> Reclaimed = 0;
+
+		ParallelFor(TEXT("FReflectionHelper::ShrinkMembers"), Containers.Num(), 16, [&](int32 Index)
+		{
+			const TPair<const UStruct*, void*>& Each = Containers[Index];
+
+			// 같은 UStruct의 Layout은 첫 호출 이후 캐시에서 읽기만 함
+			const int64 Bytes = ShrinkStruct(*FShrinkLayout::Get(Each.Key), Each.Value);
+			Reclaimed.fetch_add(Bytes, std::memory_order_relaxed);
+		});
+
+		return Reclaimed.load();
+	}
+
+	void MeasureMemory(const UStruct* Struct, const void* Container, const FReflectionDeepIterationOptions& Options, FReflectionMemoryReport& OutReport)
+	{
+		FMemoryMeasurer{ Options, OutReport }.MeasureRoot(Struct, Container);
+	}
+
+	FStreamableManager& GetStreamableManager()
+	{
+		if (UAssetManager::IsInitialized())
+		{
+			return UAssetManager::GetStreamableManager();
+		}
+
+		static FStreamableManager Fallback;
+		return Fallback;
+	}
+
+	bool SaveSnapshot(const UStruct* Struct, const void* Container, TArrayView<uint8> Buffer, int64& OutNumBytes)
+	{
+		FSnapshotArchive Ar{ Buffer.GetData(), Buffer.Num(), false };
+
+		FSnapshotHeader Header{ reinterpret_cast<UPTRINT>(Struct), Struct->GetStructureSize() };
+		SerializeHeader(Ar, Header);
+
+		// 저장 방향에서는 Container를 읽기만 함
+		SerializeStruct(Ar, *FPodSpanLayout::Get(Struct), const_cast<void*>(Container));
+
+		OutNumBytes = Ar.Tell();
+		return !Ar.HasOverflowed();
+	}
+
+	bool LoadSnapshot(const UStruct* Struct, void* Container, TConstArrayView<uint8> Buffer)
+	{
+		// 로드 방향에서는 Buffer를 읽기만 함
+		FSnapshotArchive Ar{ const_cast<uint8*>(Buffer.GetData()), Buffer.Num(), true };
+
+		FSnapshotHeader Header{};
+		SerializeHeader(Ar, Header);
+
+		if (Ar.IsError() || Header.Struct != reinterpret_cast<UPTRINT>(Struct) || Header.StructureSize != Struct->GetStructureSize())
+		{
+			return false;
+		}
+
+		SerializeStruct(Ar, *FPodSpanLayout::Get(Struct), Container);
+		return !Ar.IsError();
+	}
+
+	void VisitReachable(UObject* Root, TFunctionRef<bool(UObject*)> Func)
+	{
+		// 탐색 도중 객체가 파괴되거나 GUObjectArray 인덱스가 재사용되지 않도록 함
+		FGCScopeGuard GCGuard;
+
+		// frontier 하나를 나누어 처리할 때 작업 하나가 맡을 최소 객체 수
+		constexpr int32 MinObjectsPerBatch = 64;
+
+		FVisitedObjects Visited;
+		Visited.TryMark(Root);
+
+		TArray<UObject*> Frontier{ Root };
+		TArray<FReachabilityWorker> Workers;
+
+		// 워커 별 Layout 캐시는 깊이가 바뀌어도 재사용하도록 탐색 내내 유지
+		TArray<FReferenceLayoutMap> WorkerLayouts;
+
+		while (!Frontier.IsEmpty())
+		{
+			ParallelForWithTaskContext(TEXT("FReflectionHelper::VisitReachable"), Workers, Frontier.Num(), MinObjectsPerBatch,
+				[&](int32 ContextIndex, int32 NumContexts)
+				{
+					// 워커들은 작업을 시작하기 전에 이 스레드에서 차례로 만들어지므로 여기서 늘려도 안전함
+					if (WorkerLayouts.Num() < NumContexts)
+					{
+						WorkerLayouts.SetNum(NumContexts);
+					}
+					return FReachabilityWorker{ Visited, WorkerLayouts[ContextIndex] };
+				},
+				[&](FReachabilityWorker& Worker, int32 Index)
+				{
+					UObject* Object = Frontier[Index];
+					if (Func(Object))
+					{
+						Worker.ScanStruct(Worker.GetLayout(Object->GetClass()), reinterpret_cast<const uint8*>(Object));
+					}
+				});
+
+			Frontier.Reset();
+			for (FReachabilityWorker& Each : Workers)
+			{
+				Frontier.Append(Each.Found);
+				Each.Found.Reset();
+			}
+		}
+	}
+
+	namespace
+	{
+		void UpdateName(FXxHash64Builder& Builder, TStringBuilder<128>& Scratch, FName Name)
+		{
+			Scratch.Reset();
+			Name.AppendString(Scratch);
+			Builder.Update(Scratch.GetData(), Scratch.Len() * sizeof(TCHAR));
+		}
+
+		// 이름과 오프셋이 같아도 int32 -> float, TArray<int32> -> TArray<float>, FFoo -> FBar처럼 타입이 바뀌면 일치 여부가 달라지므로
+		// FProperty 종류와 크기, 원소 Property, 참조하는 UStruct / UEnum의 이름도 섞음
+		void UpdatePropertyKind(FXxHash64Builder& Builder, TStringBuilder<128>& Scratch, const FProperty* Property)
+		{
+			const uint64 CastFlags = Property->GetClass()->GetCastFlags();
+			const int32 Size = Property->GetSize();
+			Builder.Update(&CastFlags, sizeof(CastFlags));
+			Builder.Update(&Size, sizeof(Size));
+
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				UpdatePropertyKind(Builder, Scratch, ArrayProperty->Inner);
+			}
+			else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+			{
+				UpdatePropertyKind(Builder, Scratch, MapProperty->KeyProp);
+				UpdatePropertyKind(Builder, Scratch, MapProperty->ValueProp);
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+			{
+				UpdatePropertyKind(Builder, Scratch, SetProperty->ElementProp);
+			}
+			else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				UpdateName(Builder, Scratch, StructProperty->Struct->GetFName());
+			}
+			else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				UpdateName(Builder, Scratch, ObjectProperty->PropertyClass->GetFName());
+			}
+			else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				UpdateName(Builder, Scratch, EnumProperty->GetEnum()->GetFName());
+			}
+			else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property); ByteProperty && ByteProperty->Enum)
+			{
+				UpdateName(Builder, Scratch, ByteProperty->Enum->GetFName());
+			}
+		}
+	}
+
+	uint64 HashStructSchema(const UStruct* Struct)
+	{
+		FXxHash64Builder Builder;
+
+		TStringBuilder<128> Scratch;
+		int32 NumProperties = 0;
+		for (TFieldIterator<FProperty> It{ Struct }; It; ++It, ++NumProperties)
+		{
+			const int32 Offset = It->GetOffset_ForInternal();
+
+			UpdateName(Builder, Scratch, It->GetFName());
+			Builder.Update(&Offset, sizeof(Offset));
+			UpdatePropertyKind(Builder, Scratch, *It);
+		}
+
+		Builder.Update(&NumProperties, sizeof(NumProperties));
+		return Builder.Finalize().Hash;
+	}
+
+	TArray<const UStruct*> GetStructsInModule(FName ModuleName)
+	{
+		TArray<const UStruct*> Result;
+
+		TStringBuilder<128> PackageName;
+		PackageName << TEXT("/Script/") << ModuleName;
+
+		const UPackage* Package = FindPackage(nullptr, *PackageName);
+		if (!Package)
+		{
+			return Result;
+		}
+
+		// UFunction은 UClass 안에 있으므로 패키지 바로 아래의 객체만 보면 됨
+		ForEachObjectWithPackage(Package, [&](UObject* Object)
+		{
+			if (const UStruct* Struct = Cast<UStruct>(Object))
+			{
+				Result.Add(Struct);
+			}
+			return true;
+		}, false);
+
+		return Result;
+	}
+
+	namespace
+	{
+		constexpr uint32 LayoutCacheMagic = 0x52484C43;	// 'RHLC'
+
+		// ETypeSignatureTag, HashStructSchema, FPersistentLayoutCache::FMember나 저장되는 멤버의 순서가 바뀌면 올려야 함
+		constexpr uint32 LayoutCacheVersion = 3;
+	}
+
+	FPersistentLayoutCache::FPersistentLayoutCache(FString InFilePath)
+		: FilePath(MoveTemp(InFilePath))
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+		{
+			return;
+		}
+
+		FMemoryReader Ar{ Bytes };
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Ar << Magic << Version;
+
+		if (Magic != LayoutCacheMagic || Version != LayoutCacheVersion)
+		{
+			return;
+		}
+
+		Ar << Structs;
+
+		if (Ar.IsError())
+		{
+			UE_LOG(LogReflectionHelper, Warning, TEXT("손상된 레이아웃 캐시 파일을 무시합니다: %s"), *FilePath);
+			Structs.Reset();
+		}
+	}
+
+	const TArray<FPersistentLayoutCache::FMember>* FPersistentLayoutCache::Find(const UStruct* Struct, uint64 TypeSignature)
+	{
+		const TArray<FMember>* Members = FindOrAddEntry(Struct).Layouts.Find(TypeSignature);
+		if (Members)
+		{
+			++NumHits;
+		}
+		return Members;
+	}
+
+	void FPersistentLayoutCache::Add(const UStruct* Struct, uint64 TypeSignature, TArray<FMember> Members)
+	{
+		FindOrAddEntry(Struct).Layouts.Add(TypeSignature, MoveTemp(Members));
+		bDirty = true;
+	}
+
+	bool FPersistentLayoutCache::Save() const
+	{
+		if (!bDirty)
+		{
+			return true;
+		}
+
+		TArray<uint8> Bytes;
+		FMemoryWriter Ar{ Bytes };
+
+		uint32 Magic = LayoutCacheMagic;
+		uint32 Version = LayoutCacheVersion;
+		Ar << Magic << Version;
+
+		// 저장 방향에서는 Structs를 읽기만 함
+		Ar << const_cast<TMap<uint64, FStructEntry>&>(Structs);
+
+		return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+	}
+
+	FPersistentLayoutCache::FStructEntry& FPersistentLayoutCache::FindOrAddEntry(const UStruct* Struct)
+	{
+		if (const uint64* Identity = CheckedStructs.Find(Struct))
+		{
+			return Structs.FindChecked(*Identity);
+		}
+
+		const uint64 Identity = HashStructIdentity(Struct);
+		const uint64 SchemaHash = HashStructSchema(Struct);
+		CheckedStructs.Add(Struct, Identity);
+
+		// 멤버 구성이 바뀐 UStruct는 저장된 인덱스를 모두 버리고 다시 계산함
+		FStructEntry& Entry = Structs.FindOrAdd(Identity);
+		if (Entry.SchemaHash != SchemaHash)
+		{
+			Entry.SchemaHash = SchemaHash;
+			Entry.Layouts.Reset();
+		}
+
+		return Entry;
+	}
+}
@@ -3,6 +3,113 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/StringBuilder.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/LazyObjectPtr.h"
+#include "UObject/UnrealType.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+
+/**
+ * FReflectionHelper::ForEachMemberDeep의 순회 범위 설정
+ */
+struct FReflectionDeepIterationOptions
+{
+	/** 중첩된 구조체, TArray 원소, UObject* 멤버를 타고 들어갈 수 있는 최대 횟수 */
+	int32 MaxDepth = 8;
+
+	/** UObject* 멤버가 가리키는 객체의 멤버도 순회할지 여부 */
+	bool bFollowObjects = true;
+
+	/** bFollowObjects일 때 해당 포인터를 가진 객체를 Outer로 두는(소유된) 객체만 따라갈지 여부 */
+	bool bOnlyOwnedObjects = true;
+
+	/**
+	 * 루트가 USTRUCT일 때 그 구조체를 멤버로 가진 객체
+	 * 루트 구조체가 직접 가리키는 객체는 이 객체를 소유자로 보고 bOnlyOwnedObjects를 적용하며, 이 객체 자체는 다시 방문하지 않습니다.
+	 * nullptr이면 루트 구조체에는 소유자가 없으므로 루트 구조체가 직접 가리키는 객체는 bOnlyOwnedObjects와 관계없이 따라갑니다.
+	 * 루트가 UObject이면 루트 자신이 소유자이므로 무시됩니다.
+	 */
+	const UObject* RootOwner = nullptr;
+};
+
+
+REFLECTIONDEMO_API DECLARE_LOG_CATEGORY_EXTERN(LogReflectionHelper, Log, All);
+
+
+/**
+ * 할당된 바이트 수와 실제로 사용 중인 바이트 수
+ */
+struct FReflectionMemoryUsage
+{
+	int64 AllocatedBytes = 0;
+	int64 UsedBytes = 0;
+
+	int64 GetSlackBytes() const
+	{
+		return AllocatedBytes - UsedBytes;
+	}
+
+	FReflectionMemoryUsage& operator+=(const FReflectionMemoryUsage& Other)
+	{
+		AllocatedBytes += Other.AllocatedBytes;
+		UsedBytes += Other.UsedBytes;
+		return *this;
+	}
+};
+
+
+/**
+ * FReflectionHelper::MeasureMemory의 결과
+ */
+struct FReflectionMemoryReport
+{
+	struct FMember
+	{
+		FName Name;
+
+		/** 멤버가 소유한 힙 메모리 (따라간 UObject의 메모리 포함) */
+		FReflectionMemoryUsage Usage;
+	};
+
+	struct FClass
+	{
+		int32 NumObjects = 0;
+
+		/** 객체 자체의 크기의 합 (UStruct::GetStructureSize) */
+		int64 InstanceBytes = 0;
+
+		/** 멤버들이 소유한 힙 메모리의 합 (따라간 UObject의 메모리는 그 UObject의 UClass에 집계됨) */
+		FReflectionMemoryUsage Usage;
+	};
+
+	/** 측정한 컨테이너의 멤버들 (TFieldIterator 순서) */
+	TArray<FMember> Members;
+
+	/** 측정한 컨테이너와 따라간 UObject들을 UStruct 별로 집계한 것 */
+	TMap<const UStruct*, FClass> Classes;
+
+	/**
+	 * 측정한 모든 객체의 크기와 힙 메모리의 합
+	 */
+	FReflectionMemoryUsage GetTotal() const
+	{
+		FReflectionMemoryUsage Total;
+		for (const TPair<const UStruct*, FClass>& Each : Classes)
+		{
+			Total += FReflectionMemoryUsage{ Each.Value.InstanceBytes, Each.Value.InstanceBytes };
+			Total += Each.Value.Usage;
+		}
+		return Total;
+	}
+};
 
 
 namespace Details
@@ -41,6 +148,36 @@ namespace Details
 		using Type = decltype(GetFirstParamHelper(&FuncType::operator()));
 	};
 
+	/**
+	 * TGetFirstParam과 같지만 operator() 함수의 두 번째 파라미터의 타입을 반환하는 Type Function
+	 * @tparam FunctorType operator()를 구현하는 클래스 타입 (즉 Functor)
+	 *
+	 * 예시)
+	 * const auto SomeFunc = [](int32, FName){};
+	 * static_assert(std::is_same_v<TGetSecondParam<decltype(SomeFunc)>::Type, FName>);
+	 */
+	template <typename FunctorType>
+	struct TGetSecondParam
+	{
+	private:
+		using FuncType = std::decay_t<FunctorType>;
+
+		template<typename F, typename Ret, typename A>
+		static void GetSecondParamHelper(Ret (F::*)(A));
+
+		template<typename F, typename Ret, typename A>
+		static void GetSecondParamHelper(Ret (F::*)(A) const);
+
+		template<typename F, typename Ret, typename A, typename B, typename... Rest>
+		static B GetSecondParamHelper(Ret (F::*)(A, B, Rest...));
+
+		template<typename F, typename Ret, typename A, typename B, typename... Rest>
+		static B GetSecondParamHelper(Ret (F::*)(A, B, Rest...) const);
+		
+	public:
+		using Type = decltype(GetSecondParamHelper(&FuncType::operator()));
+	};
+
 	
 	template <typename MaybeUStructType>
 	concept CUStruct = requires { MaybeUStructType::StaticStruct(); };
@@ -98,12 +235,30 @@ namespace Details
 		using Type = FIntProperty;
 	};
 
+	template <>
+	struct TGetFPropertyTypeFromCPPType<int64>
+	{
+		using Type = FInt64Property;
+	};
+
+	template <>
+	struct TGetFPropertyTypeFromCPPType<uint8>
+	{
+		using Type = FByteProperty;
+	};
+
 	template <>
 	struct TGetFPropertyTypeFromCPPType<float>
 	{
 		using Type = FFloatProperty;
 	};
 
+	template <>
+	struct TGetFPropertyTypeFromCPPType<double>
+	{
+		using Type = FDoubleProperty;
+	};
+
 	template <>
 	struct TGetFPropertyTypeFromCPPType<bool>
 	{
@@ -116,6 +271,30 @@ namespace Details
 		using Type = FStrProperty;
 	};
 
+	template <>
+	struct TGetFPropertyTypeFromCPPType<FName>
+	{
+		using Type = FNameProperty;
+	};
+
+	template <>
+	struct TGetFPropertyTypeFromCPPType<FText>
+	{
+		using Type = FTextProperty;
+	};
+
+	template <typename EnumType> requires std::is_enum_v<EnumType>
+	struct TGetFPropertyTypeFromCPPType<EnumType>
+	{
+		using Type = FEnumProperty;
+	};
+
+	template <typename EnumType>
+	struct TGetFPropertyTypeFromCPPType<TEnumAsByte<EnumType>>
+	{
+		using Type = FByteProperty;
+	};
+
 	template <CUStruct StructType>
 	struct TGetFPropertyTypeFromCPPType<StructType>
 	{
@@ -128,6 +307,24 @@ namespace Details
 		using Type = FObjectProperty;
 	};
 
+	template <CUObject UObjectType>
+	struct TGetFPropertyTypeFromCPPType<TObjectPtr<UObjectType>>
+	{
+		using Type = FObjectProperty;
+	};
+
+	template <CUObject UObjectType>
+	struct TGetFPropertyTypeFromCPPType<TWeakObjectPtr<UObjectType>>
+	{
+		using Type = FWeakObjectProperty;
+	};
+
+	template <CUObject UObjectType>
+	struct TGetFPropertyTypeFromCPPType<TLazyObjectPtr<UObjectType>>
+	{
+		using Type = FLazyObjectProperty;
+	};
+
 	template <typename ElementType>
 	struct TGetFPropertyTypeFromCPPType<TArray<ElementType>>
 	{
@@ -157,206 +354,3202 @@ namespace Details
 	{
 		using Type = FMapProperty;
 	};
+
+	template <typename ElementType>
+	struct TGetFPropertyTypeFromCPPType<TSet<ElementType>>
+	{
+		using Type = FSetProperty;
+	};
 	// ~TGetFPropertyTypeFromCPPType
 
 
 	/**
-	 * C++ 타입과 FProperty 타입이 서로 일치하는지 검사합니다.
-	 * 예를 들어서 int32와 일치하는 FProperty의 구현은 FIntProperty이고
-	 * TArray<int32>와 일치하는 FProperty의 구현은 FArrayProperty::Inner의 타입이 FIntProperty인 FArrayProperty입니다.
+	 * 타입 시그니처를 만들 때 쓰는 타입 종류 값
+	 * 시그니처는 레이아웃 캐시 파일에도 저장되므로 기존 값을 바꾸면 FPersistentLayoutCache의 파일 버전도 올려야 합니다.
+	 */
+	enum class ETypeSignatureTag : uint64
+	{
+		Int16 = 1,
+		Int32,
+		Float,
+		Bool,
+		String,
+		Struct,
+		Object,
+		SoftObject,
+		SoftClass,
+		Array,
+		Map,
+		Int64,
+		UInt8,
+		Double,
+		Name,
+		Text,
+		WeakObject,
+		LazyObject,
+		Set,
+		Enum,
+		EnumAsByte,
+	};
+
+	constexpr uint64 MixTypeSignature(uint64 Seed, uint64 Value)
+	{
+		// splitmix64의 finalizer
+		uint64 Mixed = Seed ^ (Value + 0x9E3779B97F4A7C15ull + (Seed << 6) + (Seed >> 2));
+		Mixed = (Mixed ^ (Mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Mixed = (Mixed ^ (Mixed >> 27)) * 0x94D049BB133111EBull;
+		return Mixed ^ (Mixed >> 31);
+	}
+
+	constexpr uint64 MixTypeSignature(ETypeSignatureTag Tag, uint64 Value)
+	{
+		return MixTypeSignature(static_cast<uint64>(Tag), Value);
+	}
+
+	/**
+	 * UStruct의 경로 이름으로 만든 해시
+	 * Hot Reload로 UStruct가 다시 만들어져도 같은 값이 나옵니다.
+	 */
+	REFLECTIONDEMO_API uint64 HashStructIdentity(const UStruct* Struct);
+
+	/**
+	 * HashStructIdentity와 같지만 UEnum의 경로 이름으로 만든 해시
+	 */
+	REFLECTIONDEMO_API uint64 HashEnumIdentity(const UEnum* Enum);
+
+	/**
+	 * FProperty가 나타내는 C++ 타입의 시그니처를 계산합니다. Inner, KeyProp 등을 재귀적으로 따라가며 캐시하지 않습니다.
+	 * TTypeSignature<T>::Get()과 같은 값이 나오면 T와 정확히 일치하는 Property입니다.
+	 */
+	REFLECTIONDEMO_API uint64 ComputeTypeSignature(const FProperty* Property);
+
+	/**
+	 * ComputeTypeSignature와 같지만 UStruct의 멤버인 Property는 UStruct 별로 한 번만 계산해서 캐시해 둡니다.
+	 */
+	REFLECTIONDEMO_API uint64 GetTypeSignature(const FProperty* Property);
+
+
+	/**
+	 * C++ 타입의 64비트 시그니처를 반환하는 Type Function
+	 * 구조체와 UObject가 들어가지 않는 타입은 컴파일 타임에 계산되고, 들어가는 타입은 처음 호출될 때 UStruct의 경로로 계산됩니다.
+	 * 컨테이너는 원소 타입의 시그니처로 만들어지므로 TArray<TMap<int32, FMyStruct>>처럼 중첩된 타입도 그대로 지원됩니다.
 	 * 
-	 * @tparam TargetCPPType 검사할 C++ 타입
+	 * @tparam CPPType 시그니처가 궁금한 C++ 타입
 	 */
-	template <typename TargetCPPType>
-	struct TIsPropertyExactMatch
+	template <typename CPPType>
+	struct TTypeSignature;
+
+	template <typename CPPType>
+	concept CHasTypeSignature = requires { TTypeSignature<CPPType>::Get(); };
+
+	template <ETypeSignatureTag Tag>
+	struct TLeafTypeSignature
 	{
-		template <typename PropertyType>
-		static bool Check(PropertyType* Property)
+		static constexpr uint64 Get()
 		{
-			static_assert(std::is_same_v<typename TGetFPropertyTypeFromCPPType<TargetCPPType>::Type, PropertyType>);
-			return true;
+			return static_cast<uint64>(Tag);
 		}
 	};
 
-	template <CUStruct UStructType>
-	struct TIsPropertyExactMatch<UStructType>
+	template <> struct TTypeSignature<int16> : TLeafTypeSignature<ETypeSignatureTag::Int16> {};
+	template <> struct TTypeSignature<int32> : TLeafTypeSignature<ETypeSignatureTag::Int32> {};
+	template <> struct TTypeSignature<float> : TLeafTypeSignature<ETypeSignatureTag::Float> {};
+	template <> struct TTypeSignature<bool> : TLeafTypeSignature<ETypeSignatureTag::Bool> {};
+	template <> struct TTypeSignature<FString> : TLeafTypeSignature<ETypeSignatureTag::String> {};
+	template <> struct TTypeSignature<int64> : TLeafTypeSignature<ETypeSignatureTag::Int64> {};
+	template <> struct TTypeSignature<uint8> : TLeafTypeSignature<ETypeSignatureTag::UInt8> {};
+	template <> struct TTypeSignature<double> : TLeafTypeSignature<ETypeSignatureTag::Double> {};
+	template <> struct TTypeSignature<FName> : TLeafTypeSignature<ETypeSignatureTag::Name> {};
+	template <> struct TTypeSignature<FText> : TLeafTypeSignature<ETypeSignatureTag::Text> {};
+
+	template <typename EnumType> requires std::is_enum_v<EnumType>
+	struct TTypeSignature<EnumType>
 	{
-		static bool Check(FStructProperty* Property)
+		static uint64 Get()
 		{
-			return Property->Struct == UStructType::StaticStruct();
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::Enum, HashEnumIdentity(StaticEnum<EnumType>()));
+			return Signature;
 		}
 	};
 
-	template <CUObject UObjectType>
-	struct TIsPropertyExactMatch<UObjectType*>
+	template <typename EnumType>
+	struct TTypeSignature<TEnumAsByte<EnumType>>
 	{
-		static bool Check(FObjectProperty* Property)
+		static uint64 Get()
 		{
-			return Property->PropertyClass == UObjectType::StaticClass();
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::EnumAsByte, HashEnumIdentity(StaticEnum<EnumType>()));
+			return Signature;
 		}
 	};
 
-	template <typename ElementType>
-	struct TIsPropertyExactMatch<TArray<ElementType>>
+	template <CUStruct StructType>
+	struct TTypeSignature<StructType>
 	{
-		static bool Check(FArrayProperty* Property)
+		static uint64 Get()
 		{
-			using ElementFPropertyType = typename TGetFPropertyTypeFromCPPType<ElementType>::Type;
-			ElementFPropertyType* ElementProperty = CastField<ElementFPropertyType>(Property->Inner);
-			return ElementProperty && TIsPropertyExactMatch<ElementType>::Check(ElementProperty);
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::Struct, HashStructIdentity(StructType::StaticStruct()));
+			return Signature;
 		}
 	};
 
 	template <CUObject UObjectType>
-	struct TIsPropertyExactMatch<TSoftObjectPtr<UObjectType>>
+	struct TTypeSignature<UObjectType*>
 	{
-		static bool Check(FSoftObjectProperty* Property)
+		static uint64 Get()
 		{
-			return Property->PropertyClass == UObjectType::StaticClass();
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::Object, HashStructIdentity(UObjectType::StaticClass()));
+			return Signature;
 		}
 	};
 
+	/**
+	 * UObject*와 TObjectPtr 멤버는 모두 FObjectProperty이므로 같은 시그니처를 가집니다.
+	 * UObject*는 언제나 해석된 TObjectPtr 핸들이므로 TObjectPtr로 받는 콜백은 두 멤버를 모두 해석 없이 방문할 수 있습니다.
+	 */
+	template <CUObject UObjectType>
+	struct TTypeSignature<TObjectPtr<UObjectType>> : TTypeSignature<UObjectType*> {};
+
 	template <CUObject UObjectType>
-	struct TIsPropertyExactMatch<TSoftClassPtr<UObjectType>>
+	struct TTypeSignature<TWeakObjectPtr<UObjectType>>
 	{
-		static bool Check(FSoftClassProperty* Property)
+		static uint64 Get()
 		{
-			return Property->MetaClass == UObjectType::StaticClass();
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::WeakObject, HashStructIdentity(UObjectType::StaticClass()));
+			return Signature;
 		}
 	};
 
-	template <typename KeyType, typename ValueType>
-	struct TIsPropertyExactMatch<TMap<KeyType, ValueType>>
+	template <CUObject UObjectType>
+	struct TTypeSignature<TLazyObjectPtr<UObjectType>>
 	{
-		static bool Check(FMapProperty* Property)
+		static uint64 Get()
 		{
-			using KeyFPropertyType = typename TGetFPropertyTypeFromCPPType<KeyType>::Type;
-			using ValueFPropertyType = typename TGetFPropertyTypeFromCPPType<ValueType>::Type;
-
-			KeyFPropertyType* KeyProperty = CastField<KeyFPropertyType>(Property->KeyProp);
-			ValueFPropertyType* ValueProperty = CastField<ValueFPropertyType>(Property->ValueProp);
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::LazyObject, HashStructIdentity(UObjectType::StaticClass()));
+			return Signature;
+		}
+	};
 
-			return KeyProperty
-				&& ValueProperty
-				&& TIsPropertyExactMatch<KeyType>::Check(KeyProperty)
-				&& TIsPropertyExactMatch<ValueType>::Check(ValueProperty);
+	template <CUObject UObjectType>
+	struct TTypeSignature<TSoftObjectPtr<UObjectType>>
+	{
+		static uint64 Get()
+		{
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::SoftObject, HashStructIdentity(UObjectType::StaticClass()));
+			return Signature;
 		}
 	};
-	// ~TIsPropertyExactMatch
 
+	template <CUObject UObjectType>
+	struct TTypeSignature<TSoftClassPtr<UObjectType>>
+	{
+		static uint64 Get()
+		{
+			static const uint64 Signature = MixTypeSignature(ETypeSignatureTag::SoftClass, HashStructIdentity(UObjectType::StaticClass()));
+			return Signature;
+		}
+	};
 
-	template <typename TargetCPPType>
-	struct TFieldIterationHelper
+	template <CHasTypeSignature ElementType>
+	struct TTypeSignature<TArray<ElementType>>
 	{
-		using TargetFPropertyType = typename TGetFPropertyTypeFromCPPType<TargetCPPType>::Type;
+		static constexpr uint64 Get()
+		{
+			return MixTypeSignature(ETypeSignatureTag::Array, TTypeSignature<ElementType>::Get());
+		}
+	};
 
-		template <typename ContainerType, typename FuncType>
-		static void ForEach(ContainerType& DerefedContainer, FuncType&& Func)
+	template <CHasTypeSignature KeyType, CHasTypeSignature ValueType>
+	struct TTypeSignature<TMap<KeyType, ValueType>>
+	{
+		static constexpr uint64 Get()
 		{
-			ForEachExactMatchProperty(DerefedContainer, [&](TargetFPropertyType* Each)
-			{
-				// ContainerType 의 const 여부에 따라 const pointer 일 수도 있기 때문에 auto 로 받아야 함
-				// (ContainerPtrToValuePtr의 구현이 Container의 const 여부에 따라 리턴 타입이 다르게 되어 있음)
-				auto ValuePtr = Each->template ContainerPtrToValuePtr<TargetCPPType>(&DerefedContainer);
-				return Func(*ValuePtr);
-			});
+			return MixTypeSignature(MixTypeSignature(ETypeSignatureTag::Map, TTypeSignature<KeyType>::Get()), TTypeSignature<ValueType>::Get());
 		}
+	};
 
-		template <typename ContainerType, typename FuncType>
-		static void ForEachWithName(ContainerType& DerefedContainer, const FuncType& Func)
+	template <CHasTypeSignature ElementType>
+	struct TTypeSignature<TSet<ElementType>>
+	{
+		static constexpr uint64 Get()
 		{
-			ForEachExactMatchProperty(DerefedContainer, [&](TargetFPropertyType* Each)
-			{
-				// ContainerType 의 const 여부에 따라 const pointer 일 수도 있기 때문에 auto 로 받아야 함
-				// (ContainerPtrToValuePtr의 구현이 Container의 const 여부에 따라 리턴 타입이 다르게 되어 있음)
-				auto ValuePtr = Each->template ContainerPtrToValuePtr<TargetCPPType>(&DerefedContainer);
-				return Func(*ValuePtr, Each->GetName());
-			});
+			return MixTypeSignature(ETypeSignatureTag::Set, TTypeSignature<ElementType>::Get());
 		}
+	};
+	// ~TTypeSignature
 
-	private:
-		template <typename ContainerType, typename FuncType>
-		static void ForEachExactMatchProperty(ContainerType& DerefedContainer, FuncType&& Func)
+
+	/**
+	 * C++ 타입과 FProperty 타입이 서로 일치하는지 검사합니다.
+	 * 예를 들어서 int32와 일치하는 FProperty의 구현은 FIntProperty이고
+	 * TArray<int32>와 일치하는 FProperty의 구현은 FArrayProperty::Inner의 타입이 FIntProperty인 FArrayProperty입니다.
+	 * 중첩된 컨테이너를 재귀적으로 CastField 하는 대신 Property 별로 캐시된 시그니처 하나를 비교합니다.
+	 * FSoftObjectPtr처럼 시그니처가 없는 타입은 FProperty 타입만 일치하면 됩니다.
+	 * 
+	 * @tparam TargetCPPType 검사할 C++ 타입
+	 */
+	template <typename TargetCPPType>
+	struct TIsPropertyExactMatch
+	{
+		template <typename PropertyType>
+		static bool Check(PropertyType* Property)
 		{
-			for (TFieldIterator<TargetFPropertyType> It{ GetUStructOf(DerefedContainer) }; It; ++It)
+			static_assert(std::is_same_v<typename TGetFPropertyTypeFromCPPType<TargetCPPType>::Type, PropertyType>);
+
+			if constexpr (CHasTypeSignature<TargetCPPType>)
 			{
-				if (TIsPropertyExactMatch<TargetCPPType>::Check(*It))
-				{
-					Func(*It);
-				}
+				return GetTypeSignature(Property) == TTypeSignature<TargetCPPType>::Get();
+			}
+			else
+			{
+				return true;
 			}
 		}
 	};
 
-
-	template <typename T>
-	bool IsValidPointer(const T* Pointer)
+	/**
+	 * 실제 타입을 모르는 FProperty가 TargetCPPType과 정확히 일치하는지 검사합니다.
+	 * TFieldIterator<TargetFPropertyType>으로 순회하면서 TIsPropertyExactMatch로 검사하는 것과 같은 결과를 냅니다.
+	 */
+	template <typename TargetCPPType>
+	bool IsPropertyExactMatch(FProperty* Property)
 	{
-		if constexpr (CUObject<T>)
+		if constexpr (CHasTypeSignature<TargetCPPType>)
 		{
-			return IsValid(Pointer);
+			return GetTypeSignature(Property) == TTypeSignature<TargetCPPType>::Get();
+		}
+		else
+		{
+			using TargetFPropertyType = typename TGetFPropertyTypeFromCPPType<TargetCPPType>::Type;
+			return CastField<TargetFPropertyType>(Property) != nullptr;
 		}
-		return Pointer != nullptr;
 	}
 
-
-	template <typename MaybePointerType>
-	void DerefIfPointer(MaybePointerType&& MaybePointer, const auto& Func)
+	/**
+	 * IsPropertyExactMatch와 같지만 uint8 bFoo : 1 처럼 비트필드로 선언된 bool은 제외합니다.
+	 * 비트필드는 주소를 얻을 수 없으므로 FindMember처럼 멤버의 주소를 돌려주는 곳에서는 이 함수로 검사해야 합니다.
+	 */
+	template <typename TargetCPPType>
+	bool IsAddressableExactMatch(FProperty* Property)
 	{
-		if constexpr (std::is_pointer_v<std::decay_t<MaybePointerType>>)
+		if constexpr (std::is_same_v<TargetCPPType, bool>)
 		{
-			if (IsValidPointer(MaybePointer))
-			{
-				Func(*MaybePointer);
-			}
+			const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+			return BoolProperty && BoolProperty->IsNativeBool();
 		}
 		else
 		{
-			Func(MaybePointer);
+			return IsPropertyExactMatch<TargetCPPType>(Property);
 		}
 	}
-}
-
 
-class FReflectionHelper
-{
-public:
 	/**
-	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체의 멤버들 중 특정 타입인 것들을 순회합니다.
-	 * 
-	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
-	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
-	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
-	 * @param Func 방문되는 멤버가 유일한 파라미터인 Unary Function
+	 * 멤버의 오프셋을 구합니다.
+	 * uint8 bFoo : 1 처럼 비트필드로 선언된 bool이면 비트가 들어 있는 바이트의 오프셋과 비트 마스크를, 그 외에는 멤버의 오프셋과 0을 구합니다.
 	 */
-	template <typename ContainerType, typename FuncType>
-	static void ForEachMember(ContainerType&& Container, FuncType&& Func)
+	inline uint32 GetMemberOffset(const FProperty* Property, uint8& OutFieldMask)
 	{
-		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
-		
-		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property); BoolProperty && !BoolProperty->IsNativeBool())
 		{
-			Details::TFieldIterationHelper<TypeToIterate>::ForEach(Derefed, Func);
-		});
+			OutFieldMask = BoolProperty->GetFieldMask();
+			return static_cast<uint32>(BoolProperty->GetOffset_ForInternal() + BoolProperty->GetByteOffset());
+		}
+
+		OutFieldMask = 0;
+		return static_cast<uint32>(Property->GetOffset_ForInternal());
 	}
 
+
 	/**
-	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체의 멤버들 중 특정 타입인 것들을 순회합니다.
-	 * 위에 것과 다르게 Func의 두 번째 파라미터로 방문되는 멤버의 C++ 이름이 주어집니다.
-	 * 
-	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
-	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
-	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
-	 * @param Func 방문되는 멤버가 첫 번째 파라미터, 해당 멤버의 이름(FString)이 두 번째 파라미터인 Binary Function
+	 * UStruct 하나에 대해 미리 계산해 둔 순회 정보의 베이스 클래스
+	 * FReflectionLayoutCache에 (UStruct, 파생 클래스 타입) 쌍을 키로 저장됩니다.
+	 * 파생 클래스는 const UStruct*를 받는 생성자를 제공해야 합니다.
 	 */
-	template <typename ContainerType, typename FuncType>
-	static void ForEachMemberWithName(ContainerType&& Container, FuncType&& Func)
+	struct FReflectionLayout
 	{
-		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
+		virtual ~FReflectionLayout() = default;
+	};
+
+	/**
+	 * 타입마다 고유한 주소를 만들어내기 위한 Type Function
+	 * (const가 아니어야 링커가 같은 값을 가진 변수들을 하나로 합치지 않음)
+	 */
+	template <typename T>
+	struct TLayoutKind
+	{
+		static inline uint8 Key = 0;
+	};
+
+	/**
+	 * (UStruct, Layout 종류) 쌍에 대해 FReflectionLayout을 캐시하는 thread-safe 저장소
+	 * Hot Reload / Live Coding으로 클래스가 다시 만들어지면 전체가 폐기되고,
+	 * 저장된 UStruct가 GC 되었거나 Property 목록이 다시 링크된 경우(Blueprint 재컴파일 등)에는 해당 항목만 다시 계산됩니다.
+	 */
+	class REFLECTIONDEMO_API FReflectionLayoutCache
+	{
+	public:
+		using FLayoutRef = TSharedRef<const FReflectionLayout, ESPMode::ThreadSafe>;
+		using FLayoutPtr = TSharedPtr<const FReflectionLayout, ESPMode::ThreadSafe>;
+
+		static FReflectionLayoutCache& Get();
+
+		/**
+		 * Struct에 대해 LayoutType을 찾아 반환합니다. 없으면 LayoutType(Struct)로 만들어서 저장한 뒤 반환합니다.
+		 * 반환된 레퍼런스는 도중에 캐시가 폐기되어도 유효합니다.
+		 */
+		template <typename LayoutType>
+		TSharedRef<const LayoutType, ESPMode::ThreadSafe> FindOrAdd(const UStruct* Struct)
+		{
+			static_assert(std::is_base_of_v<FReflectionLayout, LayoutType>);
+
+			const void* Kind = &TLayoutKind<LayoutType>::Key;
+			if (FLayoutPtr Found = Find(Struct, Kind))
+			{
+				return StaticCastSharedRef<const LayoutType>(Found.ToSharedRef());
+			}
+
+			return StaticCastSharedRef<const LayoutType>(Add(Struct, Kind, MakeShared<LayoutType, ESPMode::ThreadSafe>(Struct)));
+		}
+
+		/**
+		 * LayoutType(Struct, Args...)로 만든 Layout을 저장합니다. 이미 있으면 덮어씁니다.
+		 * 파일에서 읽은 정보처럼 UStruct를 훑지 않고 Layout을 만들 수 있을 때 씁니다.
+		 */
+		template <typename LayoutType, typename... ArgTypes>
+		void Emplace(const UStruct* Struct, ArgTypes&&... Args)
+		{
+			static_assert(std::is_base_of_v<FReflectionLayout, LayoutType>);
+
+			Add(Struct, &TLayoutKind<LayoutType>::Key, MakeShared<LayoutType, ESPMode::ThreadSafe>(Struct, Forward<ArgTypes>(Args)...));
+		}
+
+		/**
+		 * 캐시된 모든 Layout을 폐기합니다.
+		 */
+		void Invalidate();
+
+	private:
+		struct FEntry
+		{
+			TWeakObjectPtr<const UStruct> Struct;
+			const FProperty* PropertyLink = nullptr;
+			FLayoutRef Layout;
+		};
+
+		using FKey = TPair<const UStruct*, const void*>;
+
+		mutable FRWLock Lock;
+		TMap<FKey, FEntry> Entries;
+
+		FReflectionLayoutCache();
+
+		FLayoutPtr Find(const UStruct* Struct, const void* Kind) const;
+		FLayoutRef Add(const UStruct* Struct, const void* Kind, FLayoutRef Layout);
+	};
+
+
+	/**
+	 * UStruct의 멤버 수와 멤버 별 이름, 오프셋, 크기, FProperty 종류로 만든 해시
+	 * 값이 같으면 이전 실행에서 계산한 멤버 목록을 그대로 써도 됩니다.
+	 * Property 목록을 한 번 훑기만 하고 할당이나 타입 문자열 생성은 하지 않습니다.
+	 */
+	REFLECTIONDEMO_API uint64 HashStructSchema(const UStruct* Struct);
+
+	/**
+	 * 모듈(/Script/ModuleName 패키지)에 선언된 모든 UClass와 UScriptStruct를 반환합니다.
+	 */
+	REFLECTIONDEMO_API TArray<const UStruct*> GetStructsInModule(FName ModuleName);
+
+	/**
+	 * (UStruct, 타입 시그니처) 별로 일치하는 멤버의 오프셋과 이름을 저장해 두는 파일
+	 * UStruct의 스키마 해시가 저장된 값과 같을 때만 저장된 멤버를 돌려주므로
+	 * 멤버가 바뀐 UStruct는 다시 계산되고 Save 시 갱신됩니다.
+	 */
+	class REFLECTIONDEMO_API FPersistentLayoutCache
+	{
+	public:
+		/**
+		 * 저장된 멤버 하나
+		 * Layout을 다시 만들 때 Property 목록을 훑지 않아도 되도록 접근에 필요한 값을 모두 담습니다.
+		 */
+		struct FMember
+		{
+			uint32 Offset = 0;
+
+			/** 비트필드 bool 멤버이면 Offset 바이트 안의 비트 마스크, 주소로 접근할 수 있는 멤버이면 0 */
+			uint8 FieldMask = 0;
+
+			FString Name;
+
+			friend FArchive& operator<<(FArchive& Ar, FMember& Member)
+			{
+				return Ar << Member.Offset << Member.FieldMask << Member.Name;
+			}
+		};
+
+		/**
+		 * @param InFilePath 읽고 쓸 파일의 경로, 파일이 없거나 버전이 다르면 빈 캐시로 시작함
+		 */
+		explicit FPersistentLayoutCache(FString InFilePath);
+
+		/**
+		 * Struct에서 TypeSignature와 일치하는 멤버들을 찾습니다.
+		 * 멤버는 TFieldIterator<TargetFPropertyType>{ Struct }로 순회했을 때의 순서입니다.
+		 * 
+		 * @return 저장된 값이 없거나 Struct의 스키마가 바뀌었으면 nullptr
+		 */
+		const TArray<FMember>* Find(const UStruct* Struct, uint64 TypeSignature);
+
+		void Add(const UStruct* Struct, uint64 TypeSignature, TArray<FMember> Members);
+
+		/**
+		 * Find가 저장된 값을 돌려준 횟수
+		 */
+		int32 GetNumHits() const
+		{
+			return NumHits;
+		}
+
+		/**
+		 * 바뀐 내용이 있을 때만 파일에 씁니다.
+		 * 
+		 * @return 파일에 쓰지 못했으면 false
+		 */
+		bool Save() const;
+
+	private:
+		struct FStructEntry
+		{
+			uint64 SchemaHash = 0;
+			TMap<uint64, TArray<FMember>> Layouts;
+
+			friend FArchive& operator<<(FArchive& Ar, FStructEntry& Entry)
+			{
+				return Ar << Entry.SchemaHash << Entry.Layouts;
+			}
+		};
+
+		FString FilePath;
+		TMap<uint64, FStructEntry> Structs;
+
+		// 스키마 검사를 UStruct 당 한 번만 하기 위해 기억해 둔 HashStructIdentity 값
+		TMap<const UStruct*, uint64> CheckedStructs;
+		int32 NumHits = 0;
+		bool bDirty = false;
+
+		FStructEntry& FindOrAddEntry(const UStruct* Struct);
+	};
+
+
+	/**
+	 * 컨테이너들을 UStruct 별로 묶어서 묶음마다 Func(UStruct, 묶인 컨테이너들)를 호출합니다.
+	 * USTRUCT() 구조체는 UStruct가 컴파일 타임에 정해지므로 묶는 과정을 생략합니다.
+	 */
+	template <typename ContainerType, typename FuncType>
+	void ForEachUStructGroup(TArrayView<ContainerType*> DerefedContainers, FuncType&& Func)
+	{
+		if constexpr (CUStruct<std::remove_const_t<ContainerType>>)
+		{
+			Func(std::remove_const_t<ContainerType>::StaticStruct(), TArrayView<ContainerType* const>{ DerefedContainers });
+		}
+		else
+		{
+			struct FGroup
+			{
+				const UStruct* Struct;
+				int32 Num = 0;
+				int32 Start = 0;
+			};
+
+			// 보통은 클래스 종류가 몇 개 되지 않고 같은 클래스가 연속되어 있으므로 선형 탐색 + 직전 그룹 재사용으로 충분
+			TArray<FGroup, TInlineAllocator<4>> Groups;
+			TArray<int32> GroupIndices;
+			GroupIndices.SetNumUninitialized(DerefedContainers.Num());
+			int32 LastGroupIndex = INDEX_NONE;
+
+			// 그룹 별 개수를 먼저 센 뒤 한 배열 안에 그룹 별 구간을 나눠 담으므로 할당은 정확한 크기로 한 번만 일어남
+			for (int32 i = 0; i < DerefedContainers.Num(); ++i)
+			{
+				const UStruct* Struct = GetUStructOf(*DerefedContainers[i]);
+				if (LastGroupIndex == INDEX_NONE || Groups[LastGroupIndex].Struct != Struct)
+				{
+					LastGroupIndex = Groups.IndexOfByPredicate([&](const FGroup& Group) { return Group.Struct == Struct; });
+					if (LastGroupIndex == INDEX_NONE)
+					{
+						LastGroupIndex = Groups.Add(FGroup{ Struct });
+					}
+				}
+
+				Groups[LastGroupIndex].Num++;
+				GroupIndices[i] = LastGroupIndex;
+			}
+
+			// 모두 같은 UStruct이면 묶을 필요 없음
+			if (Groups.Num() == 1)
+			{
+				Func(Groups[0].Struct, TArrayView<ContainerType* const>{ DerefedContainers });
+				return;
+			}
+
+			int32 Start = 0;
+			for (FGroup& Group : Groups)
+			{
+				Group.Start = Start;
+				Start += Group.Num;
+			}
+
+			TArray<ContainerType*> Grouped;
+			Grouped.SetNumUninitialized(DerefedContainers.Num());
+
+			TArray<int32, TInlineAllocator<4>> Cursors;
+			Cursors.SetNumUninitialized(Groups.Num());
+			for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+			{
+				Cursors[GroupIndex] = Groups[GroupIndex].Start;
+			}
+
+			for (int32 i = 0; i < DerefedContainers.Num(); ++i)
+			{
+				Grouped[Cursors[GroupIndices[i]]++] = DerefedContainers[i];
+			}
+
+			for (const FGroup& Group : Groups)
+			{
+				Func(Group.Struct, TArrayView<ContainerType* const>{ Grouped.GetData() + Group.Start, Group.Num });
+			}
+		}
+	}
+
+
+	/**
+	 * CPPType이 UObject* 이거나 원소(TMap은 키 또는 값)로 UObject*를 가지는 컨테이너인지 검사하는 Type Function
+	 * 이런 타입의 멤버는 실제로는 TObjectPtr 또는 TObjectPtr의 컨테이너로 선언되어 있을 수 있습니다.
+	 */
+	template <typename CPPType>
+	struct THasRawObjectPointer : std::bool_constant<std::is_pointer_v<CPPType>> {};
+
+	template <typename ElementType>
+	struct THasRawObjectPointer<TArray<ElementType>> : THasRawObjectPointer<ElementType> {};
+
+	template <typename ElementType>
+	struct THasRawObjectPointer<TSet<ElementType>> : THasRawObjectPointer<ElementType> {};
+
+	template <typename KeyType, typename ValueType>
+	struct THasRawObjectPointer<TMap<KeyType, ValueType>> : std::bool_constant<THasRawObjectPointer<KeyType>::value || THasRawObjectPointer<ValueType>::value> {};
+
+#if UE_WITH_OBJECT_HANDLE_LATE_RESOLVE
+	template <typename ElementType>
+	void ResolveRawObjectPointerElements(const TArray<ElementType>& Array);
+
+	template <typename ElementType>
+	void ResolveRawObjectPointerElements(const TSet<ElementType>& Set);
+
+	template <typename KeyType, typename ValueType>
+	void ResolveRawObjectPointerElements(const TMap<KeyType, ValueType>& Map);
+#endif
+
+	/**
+	 * TObjectPtr 멤버를 UObject*로 읽기 전에 호출합니다.
+	 * TObjectPtr의 핸들이 늦게 해석될 수 있는 빌드(UE_WITH_OBJECT_HANDLE_LATE_RESOLVE)에서만 핸들을 제자리에서 해석하고,
+	 * 그 외의 빌드에서는 TObjectPtr과 UObject*의 메모리가 같으므로 아무것도 하지 않습니다.
+	 * TArray<T*>, TSet<T*>, TMap<K, T*> 처럼 원소가 UObject*인 컨테이너는 원소들을 모두 해석합니다.
+	 * TObjectPtr, TWeakObjectPtr, TLazyObjectPtr로 받는 콜백에는 핸들을 그대로 넘기므로 해석이나 로드가 일어나지 않습니다.
+	 */
+	template <typename TargetCPPType>
+	FORCEINLINE void ResolveIfRawObjectPointer(const void* ValuePtr)
+	{
+#if UE_WITH_OBJECT_HANDLE_LATE_RESOLVE
+		if constexpr (std::is_pointer_v<TargetCPPType>)
+		{
+			reinterpret_cast<const FObjectPtr*>(ValuePtr)->Get();
+		}
+		else if constexpr (THasRawObjectPointer<TargetCPPType>::value)
+		{
+			// TObjectPtr과 UObject*는 크기가 같으므로 컨테이너의 메모리 구조도 같음
+			ResolveRawObjectPointerElements(*static_cast<const TargetCPPType*>(ValuePtr));
+		}
+#endif
+	}
+
+#if UE_WITH_OBJECT_HANDLE_LATE_RESOLVE
+	template <typename ElementType>
+	void ResolveRawObjectPointerElements(const TArray<ElementType>& Array)
+	{
+		for (const ElementType& Element : Array)
+		{
+			ResolveIfRawObjectPointer<ElementType>(&Element);
+		}
+	}
+
+	template <typename ElementType>
+	void ResolveRawObjectPointerElements(const TSet<ElementType>& Set)
+	{
+		for (const ElementType& Element : Set)
+		{
+			ResolveIfRawObjectPointer<ElementType>(&Element);
+		}
+	}
+
+	template <typename KeyType, typename ValueType>
+	void ResolveRawObjectPointerElements(const TMap<KeyType, ValueType>& Map)
+	{
+		for (const TPair<KeyType, ValueType>& Pair : Map)
+		{
+			ResolveIfRawObjectPointer<KeyType>(&Pair.Key);
+			ResolveIfRawObjectPointer<ValueType>(&Pair.Value);
+		}
+	}
+#endif
+
+
+	/**
+	 * uint8 bFoo : 1 처럼 비트필드로 선언된 bool 멤버는 주소를 얻을 수 없으므로 임시 bool로 읽어서 Func(임시 bool)를 호출하고,
+	 * 값이 바뀌었으면 다시 씁니다. ByteType이 const이면 const bool로 넘기고 쓰지 않습니다.
+	 * 다시 쓰는 것은 같은 바이트를 공유하는 다른 비트필드까지 포함한 원자적이지 않은 읽기-수정-쓰기이므로,
+	 * 한 컨테이너를 여러 스레드가 동시에 접근하는 것은 지원하지 않습니다.
+	 * 
+	 * @param BytePtr 비트가 들어 있는 바이트
+	 * @param FieldMask FBoolProperty::GetFieldMask
+	 */
+	template <typename ByteType, typename FuncType>
+	void VisitBitfield(ByteType* BytePtr, uint8 FieldMask, FuncType&& Func)
+	{
+		bool Value = (*BytePtr & FieldMask) != 0;
+
+		if constexpr (std::is_const_v<ByteType>)
+		{
+			Func(static_cast<const bool&>(Value));
+		}
+		else
+		{
+			const bool OldValue = Value;
+			Func(Value);
+
+			if (Value != OldValue)
+			{
+				*BytePtr = static_cast<uint8>(Value ? (*BytePtr | FieldMask) : (*BytePtr & ~FieldMask));
+			}
+		}
+	}
+
+
+	template <typename TargetCPPType>
+	struct TFieldIterationHelper
+	{
+		using TargetFPropertyType = typename TGetFPropertyTypeFromCPPType<TargetCPPType>::Type;
+
+		/**
+		 * UStruct 하나에서 TargetCPPType과 정확히 일치하는 멤버들의 오프셋을 평탄화 한 것
+		 * 한 번 만들어지면 순회는 오프셋 배열에 대한 단순 루프가 됩니다.
+		 * 멤버의 이름도 Layout이 살아있는 동안 유지되므로 순회 중에 문자열을 새로 만들 필요가 없습니다.
+		 */
+		struct FMemberLayout : FReflectionLayout
+		{
+			/** 선언 순서대로의 멤버 오프셋, 비트필드 bool 멤버는 비트가 들어 있는 바이트의 오프셋 */
+			TArray<uint32> Offsets;
+			TArray<FName> Names;
+			TArray<FString> NameStrings;
+
+			/**
+			 * uint8 bFoo : 1 처럼 비트필드로 선언된 bool 멤버의 비트 마스크, 주소로 접근할 수 있는 멤버는 0
+			 * 비트필드 bool 멤버가 없으면 비어 있으므로 bool이 아닌 타입의 순회는 항상 Offsets만 봅니다.
+			 */
+			TArray<uint8> FieldMasks;
+
+			int32 GetNumMembers() const
+			{
+				return Offsets.Num();
+			}
+
+			bool HasBitfields() const
+			{
+				return !FieldMasks.IsEmpty();
+			}
+
+			uint8 GetFieldMask(int32 Index) const
+			{
+				return FieldMasks.IsEmpty() ? 0 : FieldMasks[Index];
+			}
+
+			explicit FMemberLayout(const UStruct* Struct)
+			{
+				ForEachExactMatchProperty(Struct, [&](TargetFPropertyType* Each)
+				{
+					AddMember(Each);
+				});
+			}
+
+			/**
+			 * Property 목록을 훑거나 일치 여부를 검사하지 않고 레이아웃 캐시 파일에 저장된 멤버들로 만듭니다.
+			 */
+			FMemberLayout(const UStruct* Struct, TConstArrayView<FPersistentLayoutCache::FMember> Members)
+			{
+				Offsets.Reserve(Members.Num());
+				Names.Reserve(Members.Num());
+				NameStrings.Reserve(Members.Num());
+
+				for (const FPersistentLayoutCache::FMember& Each : Members)
+				{
+					Add(Each.Offset, Each.FieldMask, FName{ *Each.Name }, Each.Name);
+				}
+			}
+
+		private:
+			void AddMember(TargetFPropertyType* Property)
+			{
+				uint8 FieldMask;
+				const uint32 Offset = GetMemberOffset(Property, FieldMask);
+				Add(Offset, FieldMask, Property->GetFName(), Property->GetName());
+			}
+
+			void Add(uint32 Offset, uint8 FieldMask, FName Name, const FString& NameString)
+			{
+				// 첫 비트필드를 만났을 때 앞의 멤버들 몫을 0으로 채움
+				if (FieldMask != 0 && FieldMasks.IsEmpty())
+				{
+					FieldMasks.SetNumZeroed(Offsets.Num());
+				}
+				if (!FieldMasks.IsEmpty())
+				{
+					FieldMasks.Add(FieldMask);
+				}
+
+				Offsets.Add(Offset);
+				Names.Add(Name);
+				NameStrings.Add(NameString);
+			}
+		};
+
+		static TSharedRef<const FMemberLayout, ESPMode::ThreadSafe> GetLayout(const UStruct* Struct)
+		{
+			return FReflectionLayoutCache::Get().FindOrAdd<FMemberLayout>(Struct);
+		}
+
+		/**
+		 * Struct의 Layout을 미리 만들어 둡니다.
+		 * PersistentCache에 저장된 값이 있으면 Property 목록을 훑지 않고 저장된 오프셋으로 만들고,
+		 * 없으면 계산한 뒤 PersistentCache에 추가합니다.
+		 * 
+		 * @return PersistentCache에 저장된 값을 썼으면 true
+		 */
+		static bool Prewarm(const UStruct* Struct, FPersistentLayoutCache* PersistentCache)
+		{
+			// 시그니처가 없는 타입은 파일에 저장할 키가 없음
+			if constexpr (CHasTypeSignature<TargetCPPType>)
+			{
+				if (PersistentCache)
+				{
+					const uint64 Signature = TTypeSignature<TargetCPPType>::Get();
+					if (const TArray<FPersistentLayoutCache::FMember>* Members = PersistentCache->Find(Struct, Signature))
+					{
+						FReflectionLayoutCache::Get().Emplace<FMemberLayout>(Struct, TConstArrayView<FPersistentLayoutCache::FMember>{ *Members });
+						return true;
+					}
+
+					const auto Layout = GetLayout(Struct);
+
+					TArray<FPersistentLayoutCache::FMember> Members;
+					Members.Reserve(Layout->GetNumMembers());
+					for (int32 i = 0; i < Layout->GetNumMembers(); ++i)
+					{
+						Members.Add({ Layout->Offsets[i], Layout->GetFieldMask(i), Layout->NameStrings[i] });
+					}
+
+					PersistentCache->Add(Struct, Signature, MoveTemp(Members));
+					return false;
+				}
+			}
+
+			GetLayout(Struct);
+			return false;
+		}
+
+		/**
+		 * 컨테이너의 시작 주소와 오프셋으로 멤버에 대한 포인터를 구합니다.
+		 * ContainerType이 const이면 const 포인터를 반환합니다.
+		 */
+		template <typename ContainerType>
+		static auto GetValuePtr(ContainerType& DerefedContainer, uint32 Offset)
+		{
+			using ByteType = std::conditional_t<std::is_const_v<ContainerType>, const uint8, uint8>;
+			using ValueType = std::conditional_t<std::is_const_v<ContainerType>, const TargetCPPType, TargetCPPType>;
+
+			ByteType* ValuePtr = reinterpret_cast<ByteType*>(&DerefedContainer) + Offset;
+			ResolveIfRawObjectPointer<TargetCPPType>(ValuePtr);
+			return reinterpret_cast<ValueType*>(ValuePtr);
+		}
+
+		/**
+		 * 순서상 Index 번째 멤버를 방문합니다.
+		 * 비트필드 bool 멤버는 VisitBitfield로 임시 bool을 거쳐 방문합니다.
+		 */
+		template <typename ContainerType, typename FuncType>
+		static void VisitMember(ContainerType& DerefedContainer, const FMemberLayout& Layout, int32 Index, FuncType&& Func)
+		{
+			if constexpr (std::is_same_v<TargetCPPType, bool>)
+			{
+				if (const uint8 FieldMask = Layout.GetFieldMask(Index))
+				{
+					using ByteType = std::conditional_t<std::is_const_v<ContainerType>, const uint8, uint8>;
+					VisitBitfield(reinterpret_cast<ByteType*>(&DerefedContainer) + Layout.Offsets[Index], FieldMask, Func);
+					return;
+				}
+			}
+
+			Func(*GetValuePtr(DerefedContainer, Layout.Offsets[Index]));
+		}
+
+		/**
+		 * 모든 멤버를 선언 순서대로 방문합니다.
+		 */
+		template <typename ContainerType, typename FuncType>
+		static void ForEach(ContainerType& DerefedContainer, FuncType&& Func)
+		{
+			const auto Layout = GetLayout(GetUStructOf(DerefedContainer));
+			ForEachInLayout(DerefedContainer, *Layout, Func);
+		}
+
+		/**
+		 * Func의 두 번째 파라미터가 FName이면 FName을, 그렇지 않으면 Layout이 들고 있는 FString을 const 레퍼런스로 넘깁니다.
+		 * 따라서 두 번째 파라미터가 FName, FStringView, const FString& 중 하나이면 방문 시 힙 할당이 일어나지 않습니다.
+		 */
+		template <typename ContainerType, typename FuncType>
+		static void ForEachWithName(ContainerType& DerefedContainer, const FuncType& Func)
+		{
+			using NameType = std::decay_t<typename TGetSecondParam<FuncType>::Type>;
+
+			const auto Layout = GetLayout(GetUStructOf(DerefedContainer));
+
+			for (int32 i = 0; i < Layout->GetNumMembers(); ++i)
+			{
+				VisitMember(DerefedContainer, *Layout, i, [&](auto& Value)
+				{
+					if constexpr (std::is_same_v<NameType, FName>)
+					{
+						Func(Value, Layout->Names[i]);
+					}
+					else
+					{
+						Func(Value, Layout->NameStrings[i]);
+					}
+				});
+			}
+		}
+
+		/**
+		 * 여러 컨테이너를 UStruct 별로 묶은 뒤 묶음마다 Layout을 한 번만 가져와 순회합니다.
+		 *
+		 * @param DerefedContainers 유효성 검사가 끝난 컨테이너 포인터들
+		 */
+		template <typename ContainerType, typename FuncType>
+		static void ForEachBatch(TArrayView<ContainerType*> DerefedContainers, FuncType&& Func)
+		{
+			ForEachUStructGroup(DerefedContainers, [&](const UStruct* Struct, TArrayView<ContainerType* const> Containers)
+			{
+				const auto Layout = GetLayout(Struct);
+
+				for (ContainerType* Each : Containers)
+				{
+					ForEachInLayout(*Each, *Layout, Func);
+				}
+			});
+		}
+
+		/**
+		 * ForEachBatch와 같지만 컨테이너들을 ParallelFor로 여러 워커 스레드에 나누어 순회합니다.
+		 * Layout은 호출한 스레드에서 미리 가져오므로 워커 스레드는 오프셋 배열을 읽기만 합니다.
+		 * 배치 크기는 컨테이너 당 방문할 멤버 수에 맞춰 정하고, 배치 분배는 ParallelFor의 작업 훔치기에 맡깁니다.
+		 */
+		template <typename ContainerType, typename FuncType>
+		static void ParallelForEachBatch(TArrayView<ContainerType*> DerefedContainers, FuncType&& Func)
+		{
+			// 작업 하나가 대략 이 정도의 멤버를 방문하도록 배치 크기를 정함
+			constexpr int32 MembersPerBatch = 1024;
+
+			ForEachUStructGroup(DerefedContainers, [&](const UStruct* Struct, TArrayView<ContainerType* const> Containers)
+			{
+				const auto Layout = GetLayout(Struct);
+				if (Layout->GetNumMembers() == 0)
+				{
+					return;
+				}
+
+				const int32 MinBatchSize = FMath::Max(1, MembersPerBatch / Layout->GetNumMembers());
+
+				// 비트필드는 컨테이너 안의 바이트만 건드리므로 컨테이너 단위로 나누면 서로 다른 워커가 같은 바이트를 쓰지 않음
+				ParallelFor(TEXT("FReflectionHelper::ParallelForEachMember"), Containers.Num(), MinBatchSize, [&](int32 Index)
+				{
+					ForEachInLayout(*Containers[Index], *Layout, Func);
+				});
+			});
+		}
+
+	private:
+		template <typename ContainerType, typename FuncType>
+		static void ForEachInLayout(ContainerType& DerefedContainer, const FMemberLayout& Layout, FuncType& Func)
+		{
+			if constexpr (std::is_same_v<TargetCPPType, bool>)
+			{
+				if (Layout.HasBitfields())
+				{
+					for (int32 i = 0; i < Layout.GetNumMembers(); ++i)
+					{
+						VisitMember(DerefedContainer, Layout, i, Func);
+					}
+					return;
+				}
+			}
+
+			for (const uint32 Offset : Layout.Offsets)
+			{
+				Func(*GetValuePtr(DerefedContainer, Offset));
+			}
+		}
+
+		template <typename FuncType>
+		static void ForEachExactMatchProperty(const UStruct* Struct, FuncType&& Func)
+		{
+			for (TFieldIterator<TargetFPropertyType> It{ Struct }; It; ++It)
+			{
+				if (TIsPropertyExactMatch<TargetCPPType>::Check(*It))
+				{
+					Func(*It);
+				}
+			}
+		}
+	};
+
+
+	/**
+	 * 하위 클래스까지 일치로 취급하는 UObject 관련 타입들에 대해 멤버가 선언된 클래스를 꺼내는 Type Function
+	 * UObjectType*, TObjectPtr<UObjectType>, TSoftObjectPtr<UObjectType>, TSoftClassPtr<UObjectType>만 지원합니다.
+	 * 
+	 * @tparam TargetCPPType 상위 타입
+	 */
+	template <typename TargetCPPType>
+	struct TPolymorphicMatch;
+
+	template <CUObject UObjectType>
+	struct TPolymorphicMatch<UObjectType*>
+	{
+		static const UClass* GetTargetClass()
+		{
+			return UObjectType::StaticClass();
+		}
+
+		static const UClass* GetDeclaredClass(const FProperty* Property)
+		{
+			const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
+			return ObjectProperty ? ObjectProperty->PropertyClass : nullptr;
+		}
+	};
+
+	template <CUObject UObjectType>
+	struct TPolymorphicMatch<TObjectPtr<UObjectType>> : TPolymorphicMatch<UObjectType*> {};
+
+	template <CUObject UObjectType>
+	struct TPolymorphicMatch<TSoftObjectPtr<UObjectType>>
+	{
+		static const UClass* GetTargetClass()
+		{
+			return UObjectType::StaticClass();
+		}
+
+		static const UClass* GetDeclaredClass(const FProperty* Property)
+		{
+			// FSoftClassProperty는 FSoftObjectProperty를 상속하지만 TSoftClassPtr이므로 제외
+			const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property);
+			return SoftObjectProperty && !Property->IsA<FSoftClassProperty>() ? SoftObjectProperty->PropertyClass : nullptr;
+		}
+	};
+
+	template <CUObject UObjectType>
+	struct TPolymorphicMatch<TSoftClassPtr<UObjectType>>
+	{
+		static const UClass* GetTargetClass()
+		{
+			return UObjectType::StaticClass();
+		}
+
+		static const UClass* GetDeclaredClass(const FProperty* Property)
+		{
+			const FSoftClassProperty* SoftClassProperty = CastField<FSoftClassProperty>(Property);
+			return SoftClassProperty ? SoftClassProperty->MetaClass : nullptr;
+		}
+	};
+	// ~TPolymorphicMatch
+
+	template <typename TargetCPPType>
+	concept CHasPolymorphicMatch = requires { TPolymorphicMatch<TargetCPPType>::GetTargetClass(); };
+
+	/**
+	 * 선언된 클래스가 TargetCPPType의 클래스이거나 그 하위 클래스인 멤버들을 순회하기 위한 도구
+	 * IsChildOf 검사는 (UStruct, TargetCPPType) 별로 Layout을 만들 때 한 번만 하므로 순회 중에는 오프셋 배열만 읽습니다.
+	 * 하위 타입의 멤버를 상위 타입으로 보여주므로 멤버는 항상 const로 넘깁니다.
+	 */
+	template <CHasPolymorphicMatch TargetCPPType>
+	struct TPolymorphicFieldIterationHelper
+	{
+		struct FMemberLayout : FReflectionLayout
+		{
+			TArray<uint32> Offsets;
+
+			explicit FMemberLayout(const UStruct* Struct)
+			{
+				const UClass* TargetClass = TPolymorphicMatch<TargetCPPType>::GetTargetClass();
+
+				for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+				{
+					const UClass* DeclaredClass = TPolymorphicMatch<TargetCPPType>::GetDeclaredClass(*It);
+					if (DeclaredClass && DeclaredClass->IsChildOf(TargetClass))
+					{
+						Offsets.Add(static_cast<uint32>(It->GetOffset_ForInternal()));
+					}
+				}
+			}
+		};
+
+		template <typename ContainerType, typename FuncType>
+		static void ForEach(ContainerType& DerefedContainer, FuncType&& Func)
+		{
+			const auto Layout = FReflectionLayoutCache::Get().FindOrAdd<FMemberLayout>(GetUStructOf(DerefedContainer));
+
+			// UObject*, TObjectPtr<T>, TSoftObjectPtr<T>, TSoftClassPtr<T>는 T에 따라 메모리 구조가 달라지지 않음
+			const uint8* Base = reinterpret_cast<const uint8*>(&DerefedContainer);
+			for (const uint32 Offset : Layout->Offsets)
+			{
+				ResolveIfRawObjectPointer<TargetCPPType>(Base + Offset);
+				Func(*reinterpret_cast<const TargetCPPType*>(Base + Offset));
+			}
+		}
+	};
+
+
+	/**
+	 * 여러 C++ 타입의 멤버들을 Property 목록을 한 번만 훑어서 순회합니다.
+	 * 각 멤버는 타입이 일치하는 첫 번째 Func로 전달되며, 어느 Func로 보낼지는 컴파일 타임에 만들어진 점프 테이블로 결정되므로
+	 * Func의 개수가 늘어나도 방문 비용은 늘어나지 않습니다.
+	 *
+	 * @tparam TargetCPPTypes 각 Func가 받는 멤버의 C++ 타입 (Func와 같은 순서)
+	 */
+	template <typename... TargetCPPTypes>
+	struct TMultiFieldIterationHelper
+	{
+		/**
+		 * UStruct 하나에서 TargetCPPTypes 중 하나와 일치하는 멤버들의 (오프셋, 타입 인덱스)를 선언 순서대로 모아둔 것
+		 */
+		struct FMemberLayout : FReflectionLayout
+		{
+			struct FEntry
+			{
+				uint32 Offset;
+				uint16 TypeIndex;
+
+				/** 비트필드 bool 멤버이면 Offset 바이트 안의 비트 마스크, 주소로 접근할 수 있는 멤버이면 0 */
+				uint8 FieldMask;
+			};
+
+			TArray<FEntry> Entries;
+
+			explicit FMemberLayout(const UStruct* Struct)
+			{
+				for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+				{
+					const int32 TypeIndex = FindMatchingTypeIndex(*It, std::index_sequence_for<TargetCPPTypes...>{});
+					if (TypeIndex != INDEX_NONE)
+					{
+						uint8 FieldMask;
+						const uint32 Offset = GetMemberOffset(*It, FieldMask);
+						Entries.Add({ Offset, static_cast<uint16>(TypeIndex), FieldMask });
+					}
+				}
+			}
+		};
+
+		template <typename ContainerType, typename... FuncTypes>
+		static void ForEach(ContainerType& DerefedContainer, FuncTypes&&... Funcs)
+		{
+			static_assert(sizeof...(FuncTypes) == sizeof...(TargetCPPTypes));
+
+			auto FuncTuple = ForwardAsTuple(Funcs...);
+			ForEachImpl(DerefedContainer, FuncTuple, std::index_sequence_for<TargetCPPTypes...>{});
+		}
+
+	private:
+		template <size_t... Indices>
+		static int32 FindMatchingTypeIndex(FProperty* Property, std::index_sequence<Indices...>)
+		{
+			int32 Result = INDEX_NONE;
+			((IsPropertyExactMatch<TargetCPPTypes>(Property) ? (Result = static_cast<int32>(Indices), true) : false) || ...);
+			return Result;
+		}
+
+		template <size_t Index, typename ContainerType, typename FuncTupleType>
+		static void Invoke(FuncTupleType& Funcs, ContainerType& DerefedContainer, uint32 Offset, uint8 FieldMask)
+		{
+			using TargetCPPType = typename TTupleElement<Index, TTuple<TargetCPPTypes...>>::Type;
+
+			// 비트필드 bool 멤버는 ForEachMember와 같이 임시 bool을 거쳐 방문
+			if constexpr (std::is_same_v<TargetCPPType, bool>)
+			{
+				if (FieldMask != 0)
+				{
+					using ByteType = std::conditional_t<std::is_const_v<ContainerType>, const uint8, uint8>;
+					VisitBitfield(reinterpret_cast<ByteType*>(&DerefedContainer) + Offset, FieldMask, Funcs.template Get<Index>());
+					return;
+				}
+			}
+
+			Funcs.template Get<Index>()(*TFieldIterationHelper<TargetCPPType>::GetValuePtr(DerefedContainer, Offset));
+		}
+
+		template <typename ContainerType, typename FuncTupleType, size_t... Indices>
+		static void ForEachImpl(ContainerType& DerefedContainer, FuncTupleType& Funcs, std::index_sequence<Indices...>)
+		{
+			using FInvokeFunc = void (*)(FuncTupleType&, ContainerType&, uint32, uint8);
+			static constexpr FInvokeFunc JumpTable[] = { &Invoke<Indices, ContainerType, FuncTupleType>... };
+
+			const auto Layout = FReflectionLayoutCache::Get().FindOrAdd<FMemberLayout>(GetUStructOf(DerefedContainer));
+
+			for (const typename FMemberLayout::FEntry& Each : Layout->Entries)
+			{
+				JumpTable[Each.TypeIndex](Funcs, DerefedContainer, Each.Offset, Each.FieldMask);
+			}
+		}
+	};
+
+
+	/**
+	 * UStruct 하나의 모든 멤버를 이름으로 찾을 수 있도록 만든 해시 인덱스
+	 */
+	struct FMemberNameIndex : FReflectionLayout
+	{
+		struct FEntry
+		{
+			uint32 Offset;
+			FProperty* Property;
+
+			/** 인덱스를 만들 때 계산해 둔 타입 시그니처, 주소가 없는 비트필드 bool은 어떤 타입과도 일치하지 않도록 0 */
+			uint64 TypeSignature;
+		};
+
+		TMap<FName, FEntry> Members;
+
+		explicit FMemberNameIndex(const UStruct* Struct)
+		{
+			for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+			{
+				const FBoolProperty* BoolProperty = CastField<FBoolProperty>(*It);
+				const uint64 TypeSignature = BoolProperty && !BoolProperty->IsNativeBool() ? 0 : ComputeTypeSignature(*It);
+
+				Members.Add(It->GetFName(), FEntry{ static_cast<uint32>(It->GetOffset_ForInternal()), *It, TypeSignature });
+			}
+		}
+
+		static TSharedRef<const FMemberNameIndex, ESPMode::ThreadSafe> Get(const UStruct* Struct)
+		{
+			return FReflectionLayoutCache::Get().FindOrAdd<FMemberNameIndex>(Struct);
+		}
+
+		/**
+		 * 이름이 Name이고 타입이 TargetCPPType과 정확히 일치하는 멤버를 찾습니다. 없으면 nullptr
+		 */
+		template <typename TargetCPPType>
+		const FEntry* Find(FName Name) const
+		{
+			const FEntry* Entry = Members.Find(Name);
+			if (!Entry)
+			{
+				return nullptr;
+			}
+
+			// 시그니처 캐시의 락을 잡지 않도록 저장해 둔 시그니처와 비교
+			if constexpr (CHasTypeSignature<TargetCPPType>)
+			{
+				return Entry->TypeSignature == TTypeSignature<TargetCPPType>::Get() ? Entry : nullptr;
+			}
+			else
+			{
+				return IsAddressableExactMatch<TargetCPPType>(Entry->Property) ? Entry : nullptr;
+			}
+		}
+	};
+
+
+	/**
+	 * 중첩된 구조체, TArray<구조체>, UObject* 멤버 안에 있는 TargetCPPType 멤버까지 순회하기 위한 도구
+	 * 루트 UStruct 별로 (오프셋, 다음 노드) 로 이루어진 순회 계획을 한 번만 만들어 두므로
+	 * 반복되는 순회에서는 Property 정보를 다시 훑지 않고 메모리만 읽습니다.
+	 */
+	template <typename TargetCPPType>
+	struct TDeepIterationHelper
+	{
+		/**
+		 * 순회 계획에서 UStruct 하나에 해당하는 노드
+		 */
+		struct FNode
+		{
+			struct FHop
+			{
+				uint32 Offset;
+				uint32 ElementSize;
+				const FNode* Node;
+			};
+
+			/** TargetCPPType과 정확히 일치하는 멤버의 오프셋, 비트필드 bool 멤버는 비트가 들어 있는 바이트의 오프셋 */
+			TArray<uint32> Offsets;
+
+			/** Offsets와 같은 순서의 비트필드 bool 멤버의 비트 마스크(주소로 접근할 수 있는 멤버는 0), 비트필드가 없으면 비어 있음 */
+			TArray<uint8> FieldMasks;
+
+			/** 구조체 멤버 */
+			TArray<FHop> StructHops;
+
+			/** TArray<구조체> 멤버 */
+			TArray<FHop> StructArrayHops;
+
+			/** UObject* 멤버 (가리키는 객체의 클래스는 런타임에 정해지므로 순회할 때 해당 클래스의 계획을 가져옴) */
+			TArray<uint32> ObjectOffsets;
+
+			/** TArray<UObject*> 멤버 */
+			TArray<uint32> ObjectArrayOffsets;
+
+			/** 이 노드에서 출발해서 일치하는 멤버를 만날 가능성이 있는지 여부 (없는 노드로 가는 길은 가지치기 됨) */
+			bool bMayMatch = false;
+		};
+
+		/**
+		 * 루트 UStruct에서 도달할 수 있는 구조체들의 노드를 모두 소유하는 순회 계획
+		 * TArray<자기 자신> 같은 순환도 노드 간의 포인터로 표현됩니다.
+		 */
+		struct FPlan : FReflectionLayout
+		{
+			TArray<TUniquePtr<FNode>> Nodes;
+
+			explicit FPlan(const UStruct* Root)
+			{
+				TMap<const UStruct*, FNode*> Built;
+				BuildNode(Root, Built);
+				Prune();
+			}
+
+			const FNode& GetRoot() const
+			{
+				return *Nodes[0];
+			}
+
+		private:
+			FNode* BuildNode(const UStruct* Struct, TMap<const UStruct*, FNode*>& Built)
+			{
+				if (FNode** Found = Built.Find(Struct))
+				{
+					return *Found;
+				}
+
+				FNode* Node = Nodes.Add_GetRef(MakeUnique<FNode>()).Get();
+				Built.Add(Struct, Node);
+
+				for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+				{
+					const uint32 Offset = static_cast<uint32>(It->GetOffset_ForInternal());
+
+					if (IsPropertyExactMatch<TargetCPPType>(*It))
+					{
+						uint8 FieldMask;
+						const uint32 MemberOffset = GetMemberOffset(*It, FieldMask);
+
+						if (FieldMask != 0 && Node->FieldMasks.IsEmpty())
+						{
+							Node->FieldMasks.SetNumZeroed(Node->Offsets.Num());
+						}
+						if (!Node->FieldMasks.IsEmpty())
+						{
+							Node->FieldMasks.Add(FieldMask);
+						}
+						Node->Offsets.Add(MemberOffset);
+					}
+					else if (const FStructProperty* StructProperty = CastField<FStructProperty>(*It))
+					{
+						Node->StructHops.Add({ Offset, 0, BuildNode(StructProperty->Struct, Built) });
+					}
+
+					if (IsFollowableObjectProperty(*It))
+					{
+						Node->ObjectOffsets.Add(Offset);
+					}
+					else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*It))
+					{
+						if (const FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProperty->Inner))
+						{
+							Node->StructArrayHops.Add({ Offset, static_cast<uint32>(InnerStruct->GetSize()), BuildNode(InnerStruct->Struct, Built) });
+						}
+						else if (IsFollowableObjectProperty(ArrayProperty->Inner))
+						{
+							Node->ObjectArrayOffsets.Add(Offset);
+						}
+					}
+				}
+
+				return Node;
+			}
+
+			static bool IsFollowableObjectProperty(const FProperty* Property)
+			{
+				// UClass* 멤버를 따라가면 클래스 메타데이터를 순회하게 되므로 제외
+				return Property->IsA<FObjectProperty>() && !Property->IsA<FClassProperty>();
+			}
+
+			void Prune()
+			{
+				for (const TUniquePtr<FNode>& Each : Nodes)
+				{
+					Each->bMayMatch = !Each->Offsets.IsEmpty() || !Each->ObjectOffsets.IsEmpty() || !Each->ObjectArrayOffsets.IsEmpty();
+				}
+
+				// 순환이 있을 수 있으므로 더 이상 바뀌지 않을 때까지 전파
+				for (bool bChanged = true; bChanged;)
+				{
+					bChanged = false;
+					for (const TUniquePtr<FNode>& Each : Nodes)
+					{
+						const auto MayMatch = [](const typename FNode::FHop& Hop) { return Hop.Node->bMayMatch; };
+						if (!Each->bMayMatch && (Each->StructHops.ContainsByPredicate(MayMatch) || Each->StructArrayHops.ContainsByPredicate(MayMatch)))
+						{
+							Each->bMayMatch = true;
+							bChanged = true;
+						}
+					}
+				}
+
+				for (const TUniquePtr<FNode>& Each : Nodes)
+				{
+					const auto CannotMatch = [](const typename FNode::FHop& Hop) { return !Hop.Node->bMayMatch; };
+					Each->StructHops.RemoveAll(CannotMatch);
+					Each->StructArrayHops.RemoveAll(CannotMatch);
+				}
+			}
+		};
+
+		/**
+		 * 순회 한 번 동안의 상태 (방문한 객체, 클래스 별 계획)
+		 *
+		 * @tparam bConst 루트 컨테이너가 const이면 도달하는 모든 멤버를 const로 넘김
+		 */
+		template <bool bConst, typename FuncType>
+		struct TWalker
+		{
+			using ByteType = std::conditional_t<bConst, const uint8, uint8>;
+			using ValueType = std::conditional_t<bConst, const TargetCPPType, TargetCPPType>;
+			using ScriptArrayType = std::conditional_t<bConst, const FScriptArray, FScriptArray>;
+
+			const FReflectionDeepIterationOptions& Options;
+			FuncType& Func;
+			TSet<const UObject*> Visited;
+			TMap<const UStruct*, TSharedRef<const FPlan, ESPMode::ThreadSafe>> Plans;
+
+			void WalkNode(const FNode& Node, ByteType* Base, const UObject* Owner, int32 Depth)
+			{
+				for (int32 i = 0; i < Node.Offsets.Num(); ++i)
+				{
+					const uint32 Offset = Node.Offsets[i];
+
+					// 비트필드 bool 멤버는 ForEachMember와 같이 임시 bool을 거쳐 방문
+					if constexpr (std::is_same_v<TargetCPPType, bool>)
+					{
+						if (!Node.FieldMasks.IsEmpty() && Node.FieldMasks[i] != 0)
+						{
+							VisitBitfield(Base + Offset, Node.FieldMasks[i], Func);
+							continue;
+						}
+					}
+
+					ResolveIfRawObjectPointer<TargetCPPType>(Base + Offset);
+					Func(*reinterpret_cast<ValueType*>(Base + Offset));
+				}
+
+				if (Depth >= Options.MaxDepth)
+				{
+					return;
+				}
+
+				for (const typename FNode::FHop& Hop : Node.StructHops)
+				{
+					WalkNode(*Hop.Node, Base + Hop.Offset, Owner, Depth + 1);
+				}
+
+				for (const typename FNode::FHop& Hop : Node.StructArrayHops)
+				{
+					ScriptArrayType* Array = reinterpret_cast<ScriptArrayType*>(Base + Hop.Offset);
+					ByteType* Elements = static_cast<ByteType*>(Array->GetData());
+
+					for (int32 i = 0; i < Array->Num(); ++i)
+					{
+						WalkNode(*Hop.Node, Elements + i * Hop.ElementSize, Owner, Depth + 1);
+					}
+				}
+
+				if (!Options.bFollowObjects)
+				{
+					return;
+				}
+
+				for (const uint32 Offset : Node.ObjectOffsets)
+				{
+					ResolveIfRawObjectPointer<UObject*>(Base + Offset);
+					WalkObject(*reinterpret_cast<UObject* const*>(Base + Offset), Owner, Depth + 1);
+				}
+
+				for (const uint32 Offset : Node.ObjectArrayOffsets)
+				{
+					const FScriptArray* Array = reinterpret_cast<const FScriptArray*>(Base + Offset);
+					UObject* const* Objects = static_cast<UObject* const*>(Array->GetData());
+
+					for (int32 i = 0; i < Array->Num(); ++i)
+					{
+						ResolveIfRawObjectPointer<UObject*>(&Objects[i]);
+						WalkObject(Objects[i], Owner, Depth + 1);
+					}
+				}
+			}
+
+			void WalkObject(UObject* Object, const UObject* Owner, int32 Depth)
+			{
+				if (!IsValid(Object) || (Options.bOnlyOwnedObjects && Owner && !Object->IsInOuter(Owner)))
+				{
+					return;
+				}
+
+				bool bAlreadyVisited = false;
+				Visited.Add(Object, &bAlreadyVisited);
+				if (bAlreadyVisited)
+				{
+					return;
+				}
+
+				WalkNode(GetPlan(Object->GetClass()).GetRoot(), reinterpret_cast<ByteType*>(Object), Object, Depth);
+			}
+
+			const FPlan& GetPlan(const UStruct* Struct)
+			{
+				if (const TSharedRef<const FPlan, ESPMode::ThreadSafe>* Found = Plans.Find(Struct))
+				{
+					return Found->Get();
+				}
+
+				return Plans.Add(Struct, FReflectionLayoutCache::Get().FindOrAdd<FPlan>(Struct)).Get();
+			}
+		};
+
+		template <typename ContainerType, typename FuncType>
+		static void ForEach(ContainerType& DerefedContainer, FuncType&& Func, const FReflectionDeepIterationOptions& Options)
+		{
+			using FWalker = TWalker<std::is_const_v<ContainerType>, std::remove_reference_t<FuncType>>;
+			using ByteType = typename FWalker::ByteType;
+
+			FWalker Walker{ Options, Func };
+			const UObject* Owner = Options.RootOwner;
+
+			if constexpr (CUObject<ContainerType>)
+			{
+				Owner = &DerefedContainer;
+			}
+
+			if (Owner)
+			{
+				Walker.Visited.Add(Owner);
+			}
+
+			const FPlan& Plan = Walker.GetPlan(GetUStructOf(DerefedContainer));
+			Walker.WalkNode(Plan.GetRoot(), reinterpret_cast<ByteType*>(&DerefedContainer), Owner, 0);
+		}
+	};
+
+
+	/**
+	 * TSet / TMap 멤버가 가진 Sparse Array의 구멍을 건너뛰며 유효한 인덱스만 순회합니다.
+	 * 할당 여부 비트를 TConstSetBitIterator로 워드 단위로 훑으므로 연속된 구멍은 한 번에 건너뜁니다.
+	 * 인덱스는 같은 주소로 만든 FScriptSetHelper / FScriptMapHelper의 인덱스와 같습니다.
+	 * 
+	 * @param ScriptSetOrMap TSet 또는 TMap 멤버의 주소
+	 */
+	template <typename FuncType>
+	void ForEachValidIndex(const void* ScriptSetOrMap, FuncType&& Func)
+	{
+		// TMap은 TSet을, TSet은 TSparseArray를 첫 멤버로 가지며 원소 타입과 관계없이 FScriptSet과 메모리 배치가 같음 (엔진이 static_assert로 보장)
+		// 원소에 접근하지 않고 할당 여부 비트만 읽으므로 아무 원소 타입의 TSet으로 보고 순회해도 됨
+		using FAnySet = TSet<uint8>;
+
+		for (FAnySet::TConstIterator It = static_cast<const FAnySet*>(ScriptSetOrMap)->CreateConstIterator(); It; ++It)
+		{
+			Func(It.GetId().AsInteger());
+		}
+	}
+
+
+	/**
+	 * TArray<TargetCPPType>, TSet<TargetCPPType>, TMap<Key, TargetCPPType> 멤버들의 원소를 복사 없이 순회하기 위한 도구
+	 */
+	template <typename TargetCPPType>
+	struct TElementIterationHelper
+	{
+		enum class EContainerKind : uint8
+		{
+			Array,
+			Set,
+			Map,
+		};
+
+		/**
+		 * UStruct 하나에서 원소 타입이 TargetCPPType과 정확히 일치하는 컨테이너 멤버들을 선언 순서대로 모아둔 것
+		 */
+		struct FLayout : FReflectionLayout
+		{
+			struct FEntry
+			{
+				uint32 Offset;
+				EContainerKind Kind;
+				FProperty* Property;
+			};
+
+			TArray<FEntry> Entries;
+
+			explicit FLayout(const UStruct* Struct)
+			{
+				for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+				{
+					const uint32 Offset = static_cast<uint32>(It->GetOffset_ForInternal());
+
+					if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*It))
+					{
+						if (IsPropertyExactMatch<TargetCPPType>(ArrayProperty->Inner))
+						{
+							Entries.Add({ Offset, EContainerKind::Array, *It });
+						}
+					}
+					else if (const FSetProperty* SetProperty = CastField<FSetProperty>(*It))
+					{
+						if (IsPropertyExactMatch<TargetCPPType>(SetProperty->ElementProp))
+						{
+							Entries.Add({ Offset, EContainerKind::Set, *It });
+						}
+					}
+					else if (const FMapProperty* MapProperty = CastField<FMapProperty>(*It))
+					{
+						if (IsPropertyExactMatch<TargetCPPType>(MapProperty->ValueProp))
+						{
+							Entries.Add({ Offset, EContainerKind::Map, *It });
+						}
+					}
+				}
+			}
+		};
+
+		/**
+		 * @tparam bMutable true이면 Func가 원소를 non-const로 받으며 TSet은 순회하지 않음
+		 */
+		template <bool bMutable = false, typename ContainerType, typename FuncType>
+		static void ForEach(ContainerType& DerefedContainer, FuncType&& Func)
+		{
+			static_assert(bMutable || std::is_invocable_v<FuncType&, const TargetCPPType&>,
+				"TSet의 원소까지 방문하려면 Func가 const T& 또는 값으로 받아야 합니다. 원소를 수정하려면 ForEachMutableElement를 사용하세요");
+
+			using ByteType = std::conditional_t<std::is_const_v<ContainerType>, const uint8, uint8>;
+			using ValueType = std::conditional_t<std::is_const_v<ContainerType>, const TargetCPPType, TargetCPPType>;
+			using ScriptArrayType = std::conditional_t<std::is_const_v<ContainerType>, const FScriptArray, FScriptArray>;
+
+			const auto Layout = FReflectionLayoutCache::Get().FindOrAdd<FLayout>(GetUStructOf(DerefedContainer));
+			ByteType* Base = reinterpret_cast<ByteType*>(&DerefedContainer);
+
+			for (const typename FLayout::FEntry& Entry : Layout->Entries)
+			{
+				ByteType* ContainerPtr = Base + Entry.Offset;
+
+				switch (Entry.Kind)
+				{
+				case EContainerKind::Array:
+					{
+						ScriptArrayType* Array = reinterpret_cast<ScriptArrayType*>(ContainerPtr);
+						ValueType* Elements = static_cast<ValueType*>(Array->GetData());
+
+						for (int32 i = 0; i < Array->Num(); ++i)
+						{
+							ResolveIfRawObjectPointer<TargetCPPType>(&Elements[i]);
+							Func(Elements[i]);
+						}
+					}
+					break;
+
+				case EContainerKind::Set:
+					// 원소를 수정하면 해시가 깨지므로 const로만 넘기고, 수정하는 순회에서는 건너뜀
+					if constexpr (!bMutable)
+					{
+						FScriptSetHelper Helper{ static_cast<const FSetProperty*>(Entry.Property), ContainerPtr };
+						ForEachValidIndex(ContainerPtr, [&](int32 Index)
+						{
+							ResolveIfRawObjectPointer<TargetCPPType>(Helper.GetElementPtr(Index));
+							Func(*reinterpret_cast<const TargetCPPType*>(Helper.GetElementPtr(Index)));
+						});
+					}
+					break;
+
+				case EContainerKind::Map:
+					{
+						FScriptMapHelper Helper{ static_cast<const FMapProperty*>(Entry.Property), ContainerPtr };
+						ForEachValidIndex(ContainerPtr, [&](int32 Index)
+						{
+							ResolveIfRawObjectPointer<TargetCPPType>(Helper.GetValuePtr(Index));
+							Func(*reinterpret_cast<ValueType*>(Helper.GetValuePtr(Index)));
+						});
+					}
+					break;
+				}
+			}
+		}
+	};
+
+
+	template <typename T>
+	bool IsValidPointer(const T* Pointer)
+	{
+		if constexpr (CUObject<T>)
+		{
+			return IsValid(Pointer);
+		}
+		return Pointer != nullptr;
+	}
+
+
+	template <typename MaybePointerType>
+	void DerefIfPointer(MaybePointerType&& MaybePointer, const auto& Func)
+	{
+		if constexpr (std::is_pointer_v<std::decay_t<MaybePointerType>>)
+		{
+			if (IsValidPointer(MaybePointer))
+			{
+				Func(*MaybePointer);
+			}
+		}
+		else
+		{
+			Func(MaybePointer);
+		}
+	}
+
+
+	/**
+	 * 컨테이너들을 역참조하여 OutDerefed에 담고, 모든 컨테이너가 같은 UStruct를 가지는 경우 그 UStruct를 반환합니다.
+	 * 컨테이너가 하나도 없거나, 유효하지 않은 포인터가 있거나, UStruct가 서로 다른 컨테이너가 섞여 있으면 nullptr를 반환합니다.
+	 */
+	template <typename ContainerType, typename DerefedType>
+	const UStruct* GetUniformUStruct(TArrayView<ContainerType> Containers, TArray<DerefedType*>& OutDerefed)
+	{
+		const UStruct* Struct = nullptr;
+		OutDerefed.Reset(Containers.Num());
+
+		for (ContainerType& Each : Containers)
+		{
+			bool bUniform = false;
+
+			DerefIfPointer(Each, [&](auto& Derefed)
+			{
+				const UStruct* EachStruct = GetUStructOf(Derefed);
+				Struct = Struct ? Struct : EachStruct;
+				bUniform = EachStruct == Struct;
+				OutDerefed.Add(&Derefed);
+			});
+
+			if (!bUniform)
+			{
+				return nullptr;
+			}
+		}
+
+		return Struct;
+	}
+
+
+	/**
+	 * UStruct 하나의 멤버들을 memcpy / memcmp로 한 번에 다룰 수 있는 연속 구간(Span)과 그렇지 않은 멤버로 나눈 것
+	 * 오프셋이 맞닿아 있는 POD 멤버들은 하나의 Span으로 합쳐지며, 패딩이나 Reflection 되지 않은 멤버가 끼어 있으면 Span이 끊깁니다.
+	 * bitfield bool은 같은 바이트를 다른 bit와 공유하므로 POD로 취급하지 않습니다.
+	 * FName은 같은 이름이라도 바이트가 다를 수 있고(대소문자 보존) 프로세스마다 값이 달라지므로 POD로 취급하지 않습니다.
+	 */
+	struct REFLECTIONDEMO_API FPodSpanLayout : FReflectionLayout
+	{
+		struct FSpan
+		{
+			uint32 Offset;
+			uint32 Size;
+
+			/** 이 Span이 덮는 멤버들의 SpanMembers 상의 범위 */
+			int32 FirstMember;
+			int32 NumMembers;
+		};
+
+		/** 모든 멤버 (TFieldIterator 순서) */
+		TArray<FProperty*> Properties;
+
+		/** 오프셋 순서로 정렬된 POD 구간들 */
+		TArray<FSpan> Spans;
+
+		/** Span들이 덮는 멤버들의 Properties 인덱스 (오프셋 순서) */
+		TArray<int32> SpanMembers;
+
+		/** POD가 아닌 멤버들의 Properties 인덱스 (오프셋 순서) */
+		TArray<int32> OtherMembers;
+
+		explicit FPodSpanLayout(const UStruct* Struct);
+
+		static TSharedRef<const FPodSpanLayout, ESPMode::ThreadSafe> Get(const UStruct* Struct)
+		{
+			return FReflectionLayoutCache::Get().FindOrAdd<FPodSpanLayout>(Struct);
+		}
+
+		/**
+		 * Property의 값을 메모리 복사 / 비교로 다룰 수 있는지 여부
+		 * UObject 참조처럼 주소나 핸들을 담는 멤버는 POD여도 제외되어 멤버 별로 처리됩니다.
+		 */
+		static bool IsPlainOldData(const FProperty* Property);
+	};
+
+	/**
+	 * UStruct의 멤버들 중 TargetCPPType과 정확히 일치하는 멤버를 TFieldIterator 순서의 비트로 표시한 것
+	 */
+	template <typename TargetCPPType>
+	struct TExactMatchMask : FReflectionLayout
+	{
+		TBitArray<> Mask;
+
+		explicit TExactMatchMask(const UStruct* Struct)
+		{
+			for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+			{
+				Mask.Add(IsPropertyExactMatch<TargetCPPType>(*It));
+			}
+		}
+
+		static TSharedRef<const TExactMatchMask, ESPMode::ThreadSafe> Get(const UStruct* Struct)
+		{
+			return FReflectionLayoutCache::Get().FindOrAdd<TExactMatchMask>(Struct);
+		}
+	};
+
+	/**
+	 * @param Filter nullptr가 아니면 비트가 켜진 멤버만 비교함
+	 */
+	REFLECTIONDEMO_API TBitArray<> Diff(const UStruct* Struct, const void* A, const void* B, const TBitArray<>* Filter);
+
+	/**
+	 * @param Filter nullptr가 아니면 비트가 켜진 최상위 멤버만 해시함
+	 */
+	REFLECTIONDEMO_API uint64 HashMembers(const UStruct* Struct, const void* Container, const TBitArray<>* Filter);
+
+	/**
+	 * FReflectionHelper::ReadBoolMask / WriteBoolMask의 구현
+	 */
+	REFLECTIONDEMO_API void ReadBoolMask(const UStruct* Struct, const void* Container, TBitArray<>& OutMask);
+	REFLECTIONDEMO_API bool WriteBoolMask(const UStruct* Struct, void* Container, const TBitArray<>& Mask);
+
+	/**
+	 * UStruct 하나의 멤버들과 JSON 키로 쓸 이름을 미리 뽑아 둔 것
+	 */
+	struct FJsonMemberLayout : FReflectionLayout
+	{
+		struct FEntry
+		{
+			FProperty* Property;
+			FString Name;
+		};
+
+		TArray<FEntry> Entries;
+
+		explicit FJsonMemberLayout(const UStruct* Struct)
+		{
+			for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+			{
+				Entries.Add({ *It, It->GetName() });
+			}
+		}
+
+		static TSharedRef<const FJsonMemberLayout, ESPMode::ThreadSafe> Get(const UStruct* Struct)
+		{
+			return FReflectionLayoutCache::Get().FindOrAdd<FJsonMemberLayout>(Struct);
+		}
+	};
+
+
+	/**
+	 * 중간 FJsonObject 없이 멤버 값을 TJsonWriter에 바로 쓰는 도구
+	 * FName과 텍스트로 내보내는 값은 WriteJson 호출 한 번 동안 재사용되는 버퍼를 거치므로 값마다 FString을 할당하지 않습니다.
+	 */
+	template <typename CharType, typename PrintPolicy>
+	struct TJsonExporter
+	{
+		using WriterType = TJsonWriter<CharType, PrintPolicy>;
+
+		WriterType& Writer;
+		TStringBuilder<FName::StringBufferSize> NameBuilder;
+
+		// 맵 키와 ExportText 결과에 함께 쓰임. Writer에 넘긴 뒤에만 재귀하므로 중첩되어도 겹치지 않음
+		FString TextBuffer;
+
+		explicit TJsonExporter(WriterType& InWriter)
+			: Writer(InWriter)
+		{
+		}
+
+		void WriteStruct(const UStruct* Struct, const void* Container)
+		{
+			const auto Layout = FJsonMemberLayout::Get(Struct);
+
+			Writer.WriteObjectStart();
+
+			for (const FJsonMemberLayout::FEntry& Entry : Layout->Entries)
+			{
+				const FProperty* Property = Entry.Property;
+				Writer.WriteIdentifierPrefix(Entry.Name);
+
+				if (Property->ArrayDim == 1)
+				{
+					WriteValue(Property, Property->ContainerPtrToValuePtr<void>(Container));
+					continue;
+				}
+
+				Writer.WriteArrayStart();
+				for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+				{
+					WriteValue(Property, Property->ContainerPtrToValuePtr<void>(Container, ArrayIndex));
+				}
+				Writer.WriteArrayEnd();
+			}
+
+			Writer.WriteObjectEnd();
+		}
+
+		/**
+		 * 값 하나를 씁니다. Property는 ArrayDim이 1이라고 가정합니다.
+		 */
+		void WriteValue(const FProperty* Property, const void* ValuePtr)
+		{
+			if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				Writer.WriteValue(BoolProperty->GetPropertyValue(ValuePtr));
+			}
+			else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				const int64 Value = EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+				Writer.WriteValue(EnumProperty->GetEnum()->GetNameStringByValue(Value));
+			}
+			else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property); ByteProperty && ByteProperty->Enum)
+			{
+				Writer.WriteValue(ByteProperty->Enum->GetNameStringByValue(ByteProperty->GetPropertyValue(ValuePtr)));
+			}
+			else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+			{
+				if (NumericProperty->IsFloatingPoint())
+				{
+					Writer.WriteValue(NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+				}
+				else if (CastField<FUInt64Property>(Property))
+				{
+					// int64로 표현할 수 없는 값은 JSON 숫자의 관례대로 double로 씀
+					const uint64 Value = NumericProperty->GetUnsignedIntPropertyValue(ValuePtr);
+					if (Value > static_cast<uint64>(MAX_int64))
+					{
+						Writer.WriteValue(static_cast<double>(Value));
+					}
+					else
+					{
+						Writer.WriteValue(static_cast<int64>(Value));
+					}
+				}
+				else
+				{
+					Writer.WriteValue(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+				}
+			}
+			else if (CastField<FStrProperty>(Property))
+			{
+				Writer.WriteValue(*static_cast<const FString*>(ValuePtr));
+			}
+			else if (CastField<FNameProperty>(Property))
+			{
+				NameBuilder.Reset();
+				static_cast<const FName*>(ValuePtr)->AppendString(NameBuilder);
+				Writer.WriteValue(NameBuilder.ToView());
+			}
+			else if (CastField<FTextProperty>(Property))
+			{
+				// FText::ToString()은 표시 문자열의 레퍼런스를 반환하므로 복사되지 않음
+				const FString& Display = static_cast<const FText*>(ValuePtr)->ToString();
+				Writer.WriteValue(Display);
+			}
+			else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				WriteStruct(StructProperty->Struct, ValuePtr);
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				FScriptArrayHelper Helper{ ArrayProperty, ValuePtr };
+
+				Writer.WriteArrayStart();
+				for (int32 Index = 0; Index < Helper.Num(); ++Index)
+				{
+					WriteValue(ArrayProperty->Inner, Helper.GetRawPtr(Index));
+				}
+				Writer.WriteArrayEnd();
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+			{
+				FScriptSetHelper Helper{ SetProperty, ValuePtr };
+
+				Writer.WriteArrayStart();
+				ForEachValidIndex(ValuePtr, [&](int32 Index)
+				{
+					WriteValue(SetProperty->ElementProp, Helper.GetElementPtr(Index));
+				});
+				Writer.WriteArrayEnd();
+			}
+			else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+			{
+				FScriptMapHelper Helper{ MapProperty, ValuePtr };
+
+				// JSON 키는 문자열이어야 하므로 키는 텍스트로 내보냄
+				Writer.WriteObjectStart();
+				ForEachValidIndex(ValuePtr, [&](int32 Index)
+				{
+					TextBuffer.Reset();
+					MapProperty->KeyProp->ExportTextItem_Direct(TextBuffer, Helper.GetKeyPtr(Index), nullptr, nullptr, PPF_None);
+
+					Writer.WriteIdentifierPrefix(TextBuffer);
+					WriteValue(MapProperty->ValueProp, Helper.GetValuePtr(Index));
+				});
+				Writer.WriteObjectEnd();
+			}
+			else if (Property->IsA<FSoftObjectProperty>())
+			{
+				// 로드하지 않고 경로만 씀 (FSoftClassProperty 포함)
+				Writer.WriteValue(static_cast<const FSoftObjectPtr*>(ValuePtr)->ToString());
+			}
+			else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				if (const UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr))
+				{
+					Writer.WriteValue(Object->GetPathName());
+				}
+				else
+				{
+					Writer.WriteNull();
+				}
+			}
+			else
+			{
+				TextBuffer.Reset();
+				Property->ExportTextItem_Direct(TextBuffer, ValuePtr, nullptr, nullptr, PPF_None);
+				Writer.WriteValue(TextBuffer);
+			}
+		}
+	};
+
+
+	/**
+	 * Reader에서 JSON 객체 하나를 읽어 Container의 멤버에 씁니다.
+	 */
+	REFLECTIONDEMO_API bool ReadJson(const UStruct* Struct, void* Container, TJsonReader<TCHAR>& Reader);
+
+	/**
+	 * 컨테이너들의 멤버를 병렬로 Shrink 하고 회수한 바이트 수를 반환합니다.
+	 */
+	REFLECTIONDEMO_API int64 ShrinkMembers(TConstArrayView<TPair<const UStruct*, void*>> Containers);
+
+	REFLECTIONDEMO_API void MeasureMemory(const UStruct* Struct, const void* Container, const FReflectionDeepIterationOptions& Options, FReflectionMemoryReport& OutReport);
+
+	/**
+	 * AsyncLoadSoftMembers가 사용하는 FStreamableManager
+	 * UAssetManager가 초기화되어 있으면 그것을, 아니면 (커맨드렛 등) 모듈 전용 인스턴스를 반환합니다.
+	 */
+	REFLECTIONDEMO_API FStreamableManager& GetStreamableManager();
+
+	REFLECTIONDEMO_API bool SaveSnapshot(const UStruct* Struct, const void* Container, TArrayView<uint8> Buffer, int64& OutNumBytes);
+	REFLECTIONDEMO_API bool LoadSnapshot(const UStruct* Struct, void* Container, TConstArrayView<uint8> Buffer);
+
+	/**
+	 * FReflectionHelper::VisitReachable의 구현
+	 * Func가 false를 반환하면 해당 객체의 멤버는 따라가지 않습니다.
+	 */
+	REFLECTIONDEMO_API void VisitReachable(UObject* Root, TFunctionRef<bool(UObject*)> Func);
+}
+
+
+/**
+ * FReflectionHelper::ParallelForEachMember에서 멤버를 수정하는 방문을 허용할지 여부
+ */
+enum class EReflectionParallelAccess : uint8
+{
+	/** 멤버를 값 또는 const 레퍼런스로만 받을 수 있음 */
+	ReadOnly,
+
+	/** 멤버를 non-const 레퍼런스로 받아 수정할 수 있음 (같은 멤버에 여러 스레드가 접근하지 않는다는 것은 호출자가 보장해야 함) */
+	Mutable,
+};
+
+
+/**
+ * 여러 컨테이너에서 특정 타입의 멤버들을 모아 열(Column) 단위로 이어 붙인 것 (SoA)
+ * FReflectionHelper::GatherMembers로 채우고 FReflectionHelper::ScatterMembers로 되돌려 씁니다.
+ * 
+ * @tparam TargetCPPType 모을 멤버의 C++ 타입
+ */
+template <typename TargetCPPType>
+struct TReflectionMemberColumns
+{
+	/** 멤버를 모은 컨테이너들의 UStruct */
+	const UStruct* Struct = nullptr;
+
+	int32 NumContainers = 0;
+	int32 NumMembers = 0;
+
+	/** Values[MemberIndex * NumContainers + ContainerIndex] */
+	TArray<TargetCPPType> Values;
+
+	/**
+	 * MemberIndex 번째 멤버를 모든 컨테이너에서 모은 연속된 배열
+	 */
+	TArrayView<TargetCPPType> GetColumn(int32 MemberIndex)
+	{
+		return MakeArrayView(Values.GetData() + MemberIndex * NumContainers, NumContainers);
+	}
+
+	TArrayView<const TargetCPPType> GetColumn(int32 MemberIndex) const
+	{
+		return MakeArrayView(Values.GetData() + MemberIndex * NumContainers, NumContainers);
+	}
+};
+
+
+/**
+ * TReflectionMemberColumns::Values 같은 연속된 배열에 대한 벡터화 된 연산들
+ * float, int32는 VectorRegister로 4개씩 처리하고 int16은 컴파일러의 자동 벡터화에 맡깁니다.
+ * float의 합은 4개의 부분합을 더하는 순서로 계산되므로 순서대로 더한 값과 오차가 약간 다를 수 있습니다.
+ * 빈 배열의 Min은 해당 타입의 최대값, Max는 최소값을 반환합니다.
+ */
+struct REFLECTIONDEMO_API FReflectionColumnKernels
+{
+	static float Sum(TArrayView<const float> Values);
+	static int64 Sum(TArrayView<const int32> Values);
+	static int64 Sum(TArrayView<const int16> Values);
+
+	static float Min(TArrayView<const float> Values);
+	static int32 Min(TArrayView<const int32> Values);
+	static int16 Min(TArrayView<const int16> Values);
+
+	static float Max(TArrayView<const float> Values);
+	static int32 Max(TArrayView<const int32> Values);
+	static int16 Max(TArrayView<const int16> Values);
+
+	static void Clamp(TArrayView<float> Values, float MinValue, float MaxValue);
+	static void Clamp(TArrayView<int32> Values, int32 MinValue, int32 MaxValue);
+	static void Clamp(TArrayView<int16> Values, int16 MinValue, int16 MaxValue);
+};
+
+
+/**
+ * 많은 UObject의 멤버를 여러 프레임에 나누어 순회하기 위한 도구
+ * (객체 인덱스, 멤버 인덱스) 커서를 유지하므로 Tick마다 이전에 멈춘 멤버부터 이어서 순회합니다.
+ * 객체는 Weak 포인터로 들고 있으므로 Tick 사이에 GC 된 객체는 건너뜁니다.
+ * FReflectionHelper::MakeSlicedVisitor로 만듭니다.
+ */
+template <typename TargetCPPType, typename ObjectType, typename FuncType>
+class TReflectionSlicedVisitor
+{
+public:
+	TReflectionSlicedVisitor(TArrayView<ObjectType*> InObjects, FuncType InFunc)
+		: Func(MoveTemp(InFunc))
+	{
+		Objects.Reserve(InObjects.Num());
+		for (ObjectType* Each : InObjects)
+		{
+			Objects.Emplace(Each);
+		}
+	}
+
+	/**
+	 * 시간이 다 될 때까지 이어서 순회합니다. 시간을 넘기더라도 Tick마다 최소 한 개의 멤버는 방문합니다.
+	 * 
+	 * @param MaxMilliseconds 이번 Tick에 쓸 수 있는 최대 시간
+	 * @return 모든 객체의 순회를 마쳤으면 true
+	 */
+	bool Tick(double MaxMilliseconds)
+	{
+		using FHelper = Details::TFieldIterationHelper<TargetCPPType>;
+
+		const double EndSeconds = FPlatformTime::Seconds() + MaxMilliseconds / 1000.;
+		int32 UntilTimeCheck = TimeCheckInterval;
+
+		// 시간은 매번 확인하면 비싸므로 일정 횟수마다 확인
+		const auto IsOutOfTime = [&]()
+		{
+			if (--UntilTimeCheck > 0)
+			{
+				return false;
+			}
+
+			UntilTimeCheck = TimeCheckInterval;
+			return FPlatformTime::Seconds() >= EndSeconds;
+		};
+
+		while (ObjectIndex < Objects.Num())
+		{
+			ObjectType* Object = Objects[ObjectIndex].Get();
+			if (!Details::IsValidPointer(Object))
+			{
+				MoveToNextObject();
+				continue;
+			}
+
+			const auto Layout = FHelper::GetLayout(Object->GetClass());
+			const int32 NumMembers = Layout->GetNumMembers();
+
+			while (MemberIndex < NumMembers)
+			{
+				FHelper::VisitMember(*Object, *Layout, MemberIndex++, Func);
+
+				if (IsOutOfTime())
+				{
+					if (MemberIndex == NumMembers)
+					{
+						MoveToNextObject();
+					}
+					return IsDone();
+				}
+			}
+
+			MoveToNextObject();
+
+			if (IsOutOfTime())
+			{
+				return IsDone();
+			}
+		}
+
+		return true;
+	}
+
+	bool IsDone() const
+	{
+		return ObjectIndex >= Objects.Num();
+	}
+
+	/**
+	 * 순회를 마친 객체의 비율 (0 ~ 1)
+	 */
+	float GetProgress() const
+	{
+		return Objects.IsEmpty() ? 1.f : static_cast<float>(ObjectIndex) / Objects.Num();
+	}
+
+	int32 GetNumVisitedObjects() const
+	{
+		return ObjectIndex;
+	}
+
+	int32 GetNumObjects() const
+	{
+		return Objects.Num();
+	}
+
+	/**
+	 * 처음부터 다시 순회하도록 커서를 되돌립니다.
+	 */
+	void Reset()
+	{
+		ObjectIndex = 0;
+		MemberIndex = 0;
+	}
+
+private:
+	static constexpr int32 TimeCheckInterval = 16;
+
+	TArray<TWeakObjectPtr<ObjectType>> Objects;
+	FuncType Func;
+
+	int32 ObjectIndex = 0;
+	int32 MemberIndex = 0;
+
+	void MoveToNextObject()
+	{
+		ObjectIndex++;
+		MemberIndex = 0;
+	}
+};
+
+
+class FReflectionHelper
+{
+public:
+	/**
+	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체의 멤버들 중 특정 타입인 것들을 순회합니다.
+	 * uint8 bFoo : 1 처럼 비트필드로 선언된 bool 멤버도 선언 순서대로 방문되며, 임시 bool로 넘겨지고 바뀐 값이 다시 쓰여집니다.
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Func 방문되는 멤버가 유일한 파라미터인 Unary Function
+	 */
+	template <typename ContainerType, typename FuncType>
+	static void ForEachMember(ContainerType&& Container, FuncType&& Func)
+	{
+		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
+		
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			Details::TFieldIterationHelper<TypeToIterate>::ForEach(Derefed, Func);
+		});
+	}
+
+	/**
+	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체의 멤버들 중 특정 타입인 것들을 순회합니다.
+	 * 위에 것과 다르게 Func의 두 번째 파라미터로 방문되는 멤버의 C++ 이름이 주어집니다.
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Func 방문되는 멤버가 첫 번째 파라미터, 해당 멤버의 이름이 두 번째 파라미터인 Binary Function
+	 *             이름은 FName, FStringView, const FString& 중 하나로 받으면 힙 할당 없이 전달됩니다.
+	 *             (FString을 값으로 받으면 방문 시마다 복사가 일어남)
+	 */
+	template <typename ContainerType, typename FuncType>
+	static void ForEachMemberWithName(ContainerType&& Container, FuncType&& Func)
+	{
+		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
+		
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			Details::TFieldIterationHelper<TypeToIterate>::ForEachWithName(Derefed, Func);
+		});
+	}
+
+	/**
+	 * ForEachMember와 같지만 UObject*, TSoftObjectPtr, TSoftClassPtr 멤버는 선언된 클래스가 하위 클래스인 것까지 방문합니다.
+	 * 예를 들어 Func가 USoundPlayerComponent*를 받으면 UBGMPlayerComponent* 멤버도 방문합니다.
+	 * 하위 클래스 여부는 (UStruct, Func가 받는 타입) 별로 한 번만 검사해서 캐시합니다.
+	 * 
+	 * 상위 타입의 포인터를 통해 하위 타입 멤버에 다른 객체를 대입할 수 없도록 Func는 멤버를 값 또는 const 레퍼런스로 받아야 합니다.
+	 * 
+	 * ex)
+	 * FReflectionHelper::ForEachMemberPolymorphic(this, [&](USoundPlayerComponent* Each) { Each->Mute(bMute); });
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Func 방문되는 멤버가 유일한 파라미터인 Unary Function
+	 */
+	template <typename ContainerType, typename FuncType>
+	static void ForEachMemberPolymorphic(ContainerType&& Container, FuncType&& Func)
+	{
+		using ParamType = typename Details::TGetFirstParam<FuncType>::Type;
+		using TypeToIterate = std::decay_t<ParamType>;
+
+		static_assert(Details::CHasPolymorphicMatch<TypeToIterate>, "UObject*, TSoftObjectPtr, TSoftClassPtr만 하위 클래스까지 순회할 수 있습니다");
+		static_assert(!std::is_lvalue_reference_v<ParamType> || std::is_const_v<std::remove_reference_t<ParamType>>,
+			"하위 타입 멤버에 상위 타입 값을 대입할 수 있으므로 non-const 레퍼런스로 받을 수 없습니다");
+
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			Details::TPolymorphicFieldIterationHelper<TypeToIterate>::ForEach(Derefed, Func);
+		});
+	}
+
+	/**
+	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체의 멤버들 중 여러 타입의 것들을 한 번에 순회합니다.
+	 * 각 Func가 받는 타입은 ForEachMember와 같이 첫 번째 파라미터로 결정되고, 멤버는 타입이 일치하는 첫 번째 Func로 전달됩니다.
+	 * 비트필드 bool 멤버는 ForEachMember와 같이 임시 bool로 넘겨지고 바뀐 값이 다시 쓰여집니다.
+	 * 
+	 * 예시)
+	 * FReflectionHelper::ForEachMemberOf(Target, [](int32& Each) { ... }, [](float& Each) { ... }, [](const FString& Each) { ... });
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncTypes Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Funcs 방문되는 멤버가 유일한 파라미터인 Unary Function들
+	 */
+	template <typename ContainerType, typename... FuncTypes>
+	static void ForEachMemberOf(ContainerType&& Container, FuncTypes&&... Funcs)
+	{
+		using HelperType = Details::TMultiFieldIterationHelper<std::decay_t<typename Details::TGetFirstParam<FuncTypes>::Type>...>;
+
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			HelperType::ForEach(Derefed, Funcs...);
+		});
+	}
+
+	/**
+	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체에서 이름이 Name이고 타입이 TargetCPPType인 멤버를 찾습니다.
+	 * UStruct 별로 한 번 만들어지는 이름 해시 인덱스를 사용하므로 멤버 수와 관계없이 상수 시간에 찾습니다.
+	 * 
+	 * @tparam TargetCPPType 찾을 멤버의 C++ 타입
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Name 찾을 멤버의 C++ 이름
+	 * @return 멤버에 대한 포인터 (Container가 const이면 const 포인터), 이름이 없거나 타입이 다르거나 Container가 유효하지 않으면 nullptr
+	 *         주소가 없는 비트필드 bool 멤버도 nullptr
+	 */
+	template <typename TargetCPPType, typename ContainerType>
+	static auto FindMember(ContainerType&& Container, FName Name)
+	{
+		using DerefedType = std::remove_pointer_t<std::remove_reference_t<ContainerType>>;
+		using ResultType = std::conditional_t<std::is_const_v<DerefedType>, const TargetCPPType*, TargetCPPType*>;
+
+		ResultType Result = nullptr;
+
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			const auto Index = Details::FMemberNameIndex::Get(Details::GetUStructOf(Derefed));
+			if (const auto* Entry = Index->template Find<TargetCPPType>(Name))
+			{
+				Result = Details::TFieldIterationHelper<TargetCPPType>::GetValuePtr(Derefed, Entry->Offset);
+			}
+		});
+
+		return Result;
+	}
+
+	/**
+	 * FindMember로 멤버를 찾아 그 값을 OutValue에 복사합니다.
+	 * 
+	 * @return 멤버를 찾았으면 true, 못 찾았으면 false (이 경우 OutValue는 수정되지 않음)
+	 */
+	template <typename TargetCPPType, typename ContainerType>
+	static bool TryGetMember(ContainerType&& Container, FName Name, TargetCPPType& OutValue)
+	{
+		if (const TargetCPPType* Member = FindMember<TargetCPPType>(Container, Name))
+		{
+			OutValue = *Member;
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * FindMember로 멤버를 찾아 Value를 대입합니다.
+	 * 
+	 * @return 멤버를 찾았으면 true, 못 찾았으면 false
+	 */
+	template <typename TargetCPPType, typename ContainerType>
+	static bool SetMember(ContainerType&& Container, FName Name, const TargetCPPType& Value)
+	{
+		if (TargetCPPType* Member = FindMember<TargetCPPType>(Container, Name))
+		{
+			*Member = Value;
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * ForEachMember와 같지만 직속 멤버뿐만 아니라 구조체 멤버, TArray<구조체> 멤버의 원소,
+	 * UObject* 멤버가 가리키는 객체 안에 있는 멤버까지 재귀적으로 순회합니다.
+	 * 루트 UStruct 별로 순회 계획을 한 번 만들어 캐시하고, 같은 객체는 한 번만 방문합니다.
+	 * 비트필드 bool 멤버는 ForEachMember와 같이 임시 bool로 넘겨지고 바뀐 값이 다시 쓰여집니다.
+	 * 구조체를 넘길 때 bOnlyOwnedObjects를 적용하려면 Options.RootOwner에 그 구조체를 가진 객체를 넘깁니다.
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Func 방문되는 멤버가 유일한 파라미터인 Unary Function
+	 * @param Options 최대 깊이, UObject* 멤버를 따라갈지 여부 등
+	 */
+	template <typename ContainerType, typename FuncType>
+	static void ForEachMemberDeep(ContainerType&& Container, FuncType&& Func, const FReflectionDeepIterationOptions& Options = {})
+	{
+		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
+		
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			Details::TDeepIterationHelper<TypeToIterate>::ForEach(Derefed, Func, Options);
+		});
+	}
+
+	/**
+	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체의 TArray<T>, TSet<T>, TMap<Key, T> 멤버들의 원소(TMap은 Value)를 순회합니다.
+	 * 컨테이너를 복사하지 않고 FScriptSetHelper / FScriptMapHelper로 제자리에서 읽습니다.
+	 * TSet의 원소는 수정하면 해시가 깨지므로 Func는 const T& 또는 값으로 받아야 하며, 그렇지 않으면 컴파일되지 않습니다.
+	 * 원소를 수정하려면 TSet을 제외하고 순회하는 ForEachMutableElement를 사용합니다.
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Func 방문되는 원소가 유일한 파라미터인 Unary Function
+	 */
+	template <typename ContainerType, typename FuncType>
+	static void ForEachElement(ContainerType&& Container, FuncType&& Func)
+	{
+		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
+		
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			Details::TElementIterationHelper<TypeToIterate>::ForEach(Derefed, Func);
+		});
+	}
+
+	/**
+	 * ForEachElement와 같지만 원소를 T&로 넘겨 수정할 수 있게 합니다.
+	 * 수정하면 해시가 깨지는 TSet 멤버의 원소는 방문하지 않으며, TArray의 원소와 TMap의 Value만 방문합니다.
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Func 방문되는 원소를 T&로 받는 Unary Function
+	 */
+	template <typename ContainerType, typename FuncType>
+	static void ForEachMutableElement(ContainerType&& Container, FuncType&& Func)
+	{
+		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
 		
 		Details::DerefIfPointer(Container, [&](auto& Derefed)
 		{
-			Details::TFieldIterationHelper<TypeToIterate>::ForEachWithName(Derefed, Func);
+			Details::TElementIterationHelper<TypeToIterate>::template ForEach<true>(Derefed, Func);
+		});
+	}
+
+	/**
+	 * 여러 컨테이너에 대해 ForEachMember를 수행합니다.
+	 * 컨테이너들을 UStruct 별로 묶어서 묶음마다 멤버 정보를 한 번만 찾고, 유효하지 않은 포인터는 미리 걸러냅니다.
+	 * 방문 순서는 UStruct 별 묶음 순서를 따르므로 Containers의 순서와 다를 수 있습니다.
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Containers UObject를 상속하는 객체에 대한 포인터 또는 USTRUCT()로 선언된 구조체 객체들 (예: MakeArrayView(Components))
+	 * @param Func 방문되는 멤버가 유일한 파라미터인 Unary Function
+	 */
+	template <typename ContainerType, typename FuncType>
+	static void ForEachMemberBatch(TArrayView<ContainerType> Containers, FuncType&& Func)
+	{
+		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
+		using DerefedType = std::remove_pointer_t<ContainerType>;
+
+		TArray<DerefedType*> DerefedContainers;
+		DerefedContainers.Reserve(Containers.Num());
+
+		for (ContainerType& Each : Containers)
+		{
+			Details::DerefIfPointer(Each, [&](auto& Derefed)
+			{
+				DerefedContainers.Add(&Derefed);
+			});
+		}
+
+		Details::TFieldIterationHelper<TypeToIterate>::ForEachBatch(MakeArrayView(DerefedContainers), Func);
+	}
+
+	/**
+	 * ForEachMemberBatch와 같지만 컨테이너들을 여러 워커 스레드에 나누어 동시에 순회합니다.
+	 * Func는 여러 스레드에서 동시에 호출되므로 Func가 캡처한 상태에 대한 동기화는 Func의 책임입니다.
+	 * 순회 도중에 GC가 돌지 않도록 게임 스레드에서 호출하는 것을 전제로 합니다.
+	 * 
+	 * @tparam Access 멤버를 non-const 레퍼런스로 받으려면 EReflectionParallelAccess::Mutable을 명시해야 함
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Containers UObject를 상속하는 객체에 대한 포인터 또는 USTRUCT()로 선언된 구조체 객체들
+	 * @param Func 방문되는 멤버가 유일한 파라미터인 Unary Function
+	 */
+	template <EReflectionParallelAccess Access = EReflectionParallelAccess::ReadOnly, typename ContainerType, typename FuncType>
+	static void ParallelForEachMember(TArrayView<ContainerType> Containers, FuncType&& Func)
+	{
+		using ParamType = typename Details::TGetFirstParam<FuncType>::Type;
+		using TypeToIterate = std::decay_t<ParamType>;
+		using DerefedType = std::remove_pointer_t<ContainerType>;
+
+		constexpr bool bMutatesMember = std::is_lvalue_reference_v<ParamType> && !std::is_const_v<std::remove_reference_t<ParamType>>;
+		static_assert(!bMutatesMember || Access == EReflectionParallelAccess::Mutable,
+			"멤버를 수정하는 병렬 순회는 EReflectionParallelAccess::Mutable을 명시해야 합니다");
+
+		TArray<DerefedType*> DerefedContainers;
+		DerefedContainers.Reserve(Containers.Num());
+
+		for (ContainerType& Each : Containers)
+		{
+			Details::DerefIfPointer(Each, [&](auto& Derefed)
+			{
+				DerefedContainers.Add(&Derefed);
+			});
+		}
+
+		Details::TFieldIterationHelper<TypeToIterate>::ParallelForEachBatch(MakeArrayView(DerefedContainers), Func);
+	}
+
+	/**
+	 * 여러 컨테이너에서 TargetCPPType 멤버들의 값을 모아 OutColumns에 멤버 별로 연속되게(SoA) 담습니다.
+	 * 멤버 오프셋은 한 번만 찾고, trivially copyable한 타입은 생성자 호출 없이 바로 복사합니다.
+	 * 모은 값은 FReflectionColumnKernels 등으로 한 번에 처리한 뒤 ScatterMembers로 되돌려 쓸 수 있습니다.
+	 * 비트필드 bool 멤버도 선언 순서대로 포함되며, 주소가 없으므로 임시 bool을 거쳐 멤버 별로 읽습니다.
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam TargetCPPType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Containers UObject를 상속하는 객체에 대한 포인터 또는 USTRUCT()로 선언된 구조체 객체들, 모두 UStruct가 같아야 함
+	 * @param OutColumns 모은 값을 담을 곳, 기존 내용은 지워짐
+	 * @return 컨테이너가 하나도 없거나, 유효하지 않은 포인터가 있거나, UStruct가 서로 다른 컨테이너가 섞여 있으면 false
+	 */
+	template <typename ContainerType, typename TargetCPPType>
+	static bool GatherMembers(TArrayView<ContainerType> Containers, TReflectionMemberColumns<TargetCPPType>& OutColumns)
+	{
+		using HelperType = Details::TFieldIterationHelper<TargetCPPType>;
+		using DerefedType = std::remove_pointer_t<ContainerType>;
+
+		TArray<DerefedType*> DerefedContainers;
+		const UStruct* Struct = Details::GetUniformUStruct(Containers, DerefedContainers);
+		if (!Struct)
+		{
+			return false;
+		}
+
+		const auto Layout = HelperType::GetLayout(Struct);
+
+		OutColumns.Struct = Struct;
+		OutColumns.NumContainers = DerefedContainers.Num();
+		OutColumns.NumMembers = Layout->GetNumMembers();
+		OutColumns.Values.Reset(OutColumns.NumContainers * OutColumns.NumMembers);
+
+		if (Layout->HasBitfields())
+		{
+			for (int32 MemberIndex = 0; MemberIndex < OutColumns.NumMembers; ++MemberIndex)
+			{
+				for (const DerefedType* Each : DerefedContainers)
+				{
+					HelperType::VisitMember(*Each, *Layout, MemberIndex, [&](const TargetCPPType& Value)
+					{
+						OutColumns.Values.Add(Value);
+					});
+				}
+			}
+		}
+		else if constexpr (std::is_trivially_copyable_v<TargetCPPType>)
+		{
+			OutColumns.Values.AddUninitialized(OutColumns.NumContainers * OutColumns.NumMembers);
+			TargetCPPType* Out = OutColumns.Values.GetData();
+
+			for (const uint32 Offset : Layout->Offsets)
+			{
+				for (DerefedType* Each : DerefedContainers)
+				{
+					*Out++ = *HelperType::GetValuePtr(*Each, Offset);
+				}
+			}
+		}
+		else
+		{
+			for (const uint32 Offset : Layout->Offsets)
+			{
+				for (DerefedType* Each : DerefedContainers)
+				{
+					OutColumns.Values.Add(*HelperType::GetValuePtr(*Each, Offset));
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * GatherMembers로 모은 값들을 컨테이너들의 멤버에 되돌려 씁니다.
+	 * 
+	 * @param Containers GatherMembers에 넘겼던 것과 같은 컨테이너들
+	 * @param Columns GatherMembers로 채운 값
+	 * @return Containers가 Columns를 만들 때와 UStruct 또는 개수가 다르면 아무것도 쓰지 않고 false
+	 */
+	template <typename ContainerType, typename TargetCPPType>
+	static bool ScatterMembers(TArrayView<ContainerType> Containers, const TReflectionMemberColumns<TargetCPPType>& Columns)
+	{
+		using HelperType = Details::TFieldIterationHelper<TargetCPPType>;
+		using DerefedType = std::remove_pointer_t<ContainerType>;
+
+		TArray<DerefedType*> DerefedContainers;
+		const UStruct* Struct = Details::GetUniformUStruct(Containers, DerefedContainers);
+		if (!Struct || Struct != Columns.Struct || DerefedContainers.Num() != Columns.NumContainers)
+		{
+			return false;
+		}
+
+		const auto Layout = HelperType::GetLayout(Struct);
+		if (Layout->GetNumMembers() != Columns.NumMembers)
+		{
+			return false;
+		}
+
+		const TargetCPPType* In = Columns.Values.GetData();
+
+		if (Layout->HasBitfields())
+		{
+			for (int32 MemberIndex = 0; MemberIndex < Columns.NumMembers; ++MemberIndex)
+			{
+				for (DerefedType* Each : DerefedContainers)
+				{
+					HelperType::VisitMember(*Each, *Layout, MemberIndex, [&](TargetCPPType& Value)
+					{
+						Value = *In++;
+					});
+				}
+			}
+			return true;
+		}
+
+		for (const uint32 Offset : Layout->Offsets)
+		{
+			for (DerefedType* Each : DerefedContainers)
+			{
+				*HelperType::GetValuePtr(*Each, Offset) = *In++;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * 같은 타입의 두 객체에서 값이 다른 멤버들을 찾습니다.
+	 * 반환되는 비트 배열은 TFieldIterator 순서의 멤버 인덱스로 접근하며, 값이 다른 멤버의 비트가 켜져 있습니다.
+	 * 
+	 * 맞닿은 POD 멤버들은 하나의 구간으로 묶어 memcmp로 한 번에 비교하고, 구간이 다를 때만 멤버 별로 다시 비교합니다.
+	 * POD 멤버는 비트 단위로 비교하므로 0.f와 -0.f는 다르다고 판단합니다.
+	 * 그 외의 멤버(FString, TArray, 구조체 등)는 FProperty::Identical로 비교합니다.
+	 * 
+	 * ex) 
+	 * const TBitArray<> Dirty = FReflectionHelper::Diff(Object, GetDefault<UMyObject>());
+	 * const TBitArray<> DirtyFloats = FReflectionHelper::Diff<float>(Object, GetDefault<UMyObject>());
+	 * 
+	 * @tparam TargetCPPType void가 아니면 이 타입과 정확히 일치하는 멤버만 비교하며, 나머지 멤버의 비트는 항상 꺼져 있음
+	 * @param A UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param B A와 같은 UStruct를 가지는 객체 (ex: A의 CDO)
+	 * @return 두 객체의 UStruct가 다르거나 유효하지 않은 포인터가 있으면 빈 비트 배열
+	 */
+	template <typename TargetCPPType = void, typename ContainerTypeA, typename ContainerTypeB>
+	static TBitArray<> Diff(const ContainerTypeA& A, const ContainerTypeB& B)
+	{
+		TBitArray<> Result;
+
+		Details::DerefIfPointer(A, [&](const auto& DerefedA)
+		{
+			Details::DerefIfPointer(B, [&](const auto& DerefedB)
+			{
+				const UStruct* Struct = Details::GetUStructOf(DerefedA);
+				if (Struct != Details::GetUStructOf(DerefedB))
+				{
+					return;
+				}
+
+				if constexpr (std::is_void_v<TargetCPPType>)
+				{
+					Result = Details::Diff(Struct, &DerefedA, &DerefedB, nullptr);
+				}
+				else
+				{
+					const auto Filter = Details::TExactMatchMask<TargetCPPType>::Get(Struct);
+					Result = Details::Diff(Struct, &DerefedA, &DerefedB, &Filter->Mask);
+				}
+			});
+		});
+
+		return Result;
+	}
+
+	/**
+	 * 객체의 멤버 값들로부터 64비트 해시를 계산합니다. 파생 데이터 캐시의 키 등으로 사용할 수 있습니다.
+	 * 
+	 * UStruct 별로 캐시해 둔 POD 구간들을 xxHash64에 그대로 흘려 넣고, FString, TArray, TMap, TSet, 구조체 멤버는 재귀적으로 해시합니다.
+	 * 값이 같으면 프로세스가 달라도 같은 해시가 나오도록 FName, UObject*, Soft 포인터는 문자열(경로)로 해시하고,
+	 * TSet / TMap은 원소의 순서와 무관하게 해시합니다.
+	 * POD 멤버는 비트 단위로 해시하므로 0.f와 -0.f는 다른 해시를 만듭니다.
+	 * 
+	 * @tparam TargetCPPType void가 아니면 이 타입과 정확히 일치하는 멤버만 해시함
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @return Container가 유효하지 않은 포인터이면 0
+	 */
+	template <typename TargetCPPType = void, typename ContainerType>
+	static uint64 HashMembers(const ContainerType& Container)
+	{
+		uint64 Result = 0;
+
+		Details::DerefIfPointer(Container, [&](const auto& Derefed)
+		{
+			const UStruct* Struct = Details::GetUStructOf(Derefed);
+
+			if constexpr (std::is_void_v<TargetCPPType>)
+			{
+				Result = Details::HashMembers(Struct, &Derefed, nullptr);
+			}
+			else
+			{
+				const auto Filter = Details::TExactMatchMask<TargetCPPType>::Get(Struct);
+				Result = Details::HashMembers(Struct, &Derefed, &Filter->Mask);
+			}
+		});
+
+		return Result;
+	}
+
+	/**
+	 * 객체의 모든 bool 멤버(비트필드 포함)를 선언 순서대로 한 비트씩 OutMask에 읽어 들입니다.
+	 * 같은 바이트를 공유하는 연속된 비트필드들은 UStruct 별로 캐시된 (바이트, 마스크) 묶음으로 합쳐져서 바이트 하나를 읽을 때 한 번에 옮겨지므로
+	 * 플래그가 많은 컴포넌트도 몇 번의 마스크 연산으로 스냅샷을 찍고 TBitArray끼리 비교할 수 있습니다.
+	 * 
+	 * ex)
+	 * TBitArray<> Before;
+	 * FReflectionHelper::ReadBoolMask(Component, Before);
+	 * ...
+	 * FReflectionHelper::WriteBoolMask(Component, Before);
+	 * 
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param OutMask 읽은 값, Container가 유효하지 않은 포인터이면 비어 있음
+	 */
+	template <typename ContainerType>
+	static void ReadBoolMask(const ContainerType& Container, TBitArray<>& OutMask)
+	{
+		OutMask.Reset();
+
+		Details::DerefIfPointer(Container, [&](const auto& Derefed)
+		{
+			Details::ReadBoolMask(Details::GetUStructOf(Derefed), &Derefed, OutMask);
+		});
+	}
+
+	/**
+	 * ReadBoolMask로 읽은 값을 다시 씁니다. 같은 바이트를 공유하는 비트필드들은 마스크 연산 한 번으로 함께 쓰여집니다.
+	 * 
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Mask 같은 UStruct에서 ReadBoolMask로 읽은 값
+	 * @return Container가 유효하지 않은 포인터이거나 Mask의 비트 수가 bool 멤버 수와 다르면 아무것도 쓰지 않고 false
+	 */
+	template <typename ContainerType>
+	static bool WriteBoolMask(ContainerType&& Container, const TBitArray<>& Mask)
+	{
+		bool bResult = false;
+
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			static_assert(!std::is_const_v<std::remove_reference_t<decltype(Derefed)>>, "const 객체에는 쓸 수 없습니다");
+
+			bResult = Details::WriteBoolMask(Details::GetUStructOf(Derefed), &Derefed, Mask);
+		});
+
+		return bResult;
+	}
+
+	/**
+	 * UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체의 모든 멤버 값을 호출자가 준 버퍼에 기록합니다.
+	 * UStruct 별로 맞닿은 POD 멤버들을 하나의 memcpy로 합친 계획을 캐시해 두고, FString, TArray, TMap, TSet, 구조체, UObject* 멤버만 개별적으로 기록합니다.
+	 * 버퍼 외에 중간 할당은 하지 않습니다 (위에 나열되지 않은 드문 타입은 SerializeItem으로 기록되며 이 경우는 예외).
+	 * 
+	 * 스냅샷은 롤백 등 같은 프로세스 안에서 되돌리기 위한 것입니다. FName과 UObject*를 내부 표현(UObject*는 Weak 포인터)으로 기록하므로
+	 * 파일로 저장해서 다른 프로세스에서 읽는 용도로는 쓸 수 없습니다.
+	 * 
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Buffer 스냅샷을 기록할 버퍼
+	 * @param OutNumBytes 기록한 바이트 수, 버퍼가 모자랐다면 필요한 바이트 수
+	 * @return 버퍼가 모자랐거나 Container가 유효하지 않으면 false
+	 */
+	template <typename ContainerType>
+	static bool SaveSnapshot(const ContainerType& Container, TArrayView<uint8> Buffer, int64& OutNumBytes)
+	{
+		bool bSucceeded = false;
+		OutNumBytes = 0;
+
+		Details::DerefIfPointer(Container, [&](const auto& Derefed)
+		{
+			bSucceeded = Details::SaveSnapshot(Details::GetUStructOf(Derefed), &Derefed, Buffer, OutNumBytes);
+		});
+
+		return bSucceeded;
+	}
+
+	/**
+	 * SaveSnapshot으로 기록한 값을 Container에 되돌립니다.
+	 * 
+	 * @param Container SaveSnapshot에 넘겼던 것과 같은 타입의 객체
+	 * @param Buffer SaveSnapshot으로 기록한 버퍼
+	 * @return 스냅샷의 타입이 Container와 다르거나 버퍼가 손상되었으면 false (손상된 경우 일부 멤버만 되돌려졌을 수 있음)
+	 */
+	template <typename ContainerType>
+	static bool LoadSnapshot(ContainerType&& Container, TConstArrayView<uint8> Buffer)
+	{
+		bool bSucceeded = false;
+
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			bSucceeded = Details::LoadSnapshot(Details::GetUStructOf(Derefed), &Derefed, Buffer);
+		});
+
+		return bSucceeded;
+	}
+
+	/**
+	 * 객체의 멤버들을 JSON 객체 하나로 Writer에 바로 씁니다.
+	 * FJsonObjectConverter와 달리 중간 FJsonObject 트리를 만들지 않으며, 멤버 이름은 UStruct 별로 한 번만 구해 둡니다.
+	 * Writer가 배열이나 객체 안에 있을 때도 값 하나로 쓰이므로 여러 객체를 한 배열에 이어서 쓸 수 있습니다.
+	 * 
+	 * 숫자, bool, FString, FName, FText, 열거형, 구조체, TArray, TSet(배열로), TMap(키를 텍스트로 내보낸 객체로),
+	 * Soft 포인터(경로), UObject*(경로 또는 null)를 지원하며, 그 외의 타입은 ExportText 결과를 문자열로 씁니다.
+	 * 
+	 * ex)
+	 * FString Json;
+	 * const auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+	 * Writer->WriteArrayStart();
+	 * for (const UMyObject* Each : Objects)
+	 * {
+	 *     FReflectionHelper::WriteJson(Each, *Writer);
+	 * }
+	 * Writer->WriteArrayEnd();
+	 * Writer->Close();
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Writer 값을 쓸 수 있는 상태의 Writer
+	 */
+	template <typename ContainerType, typename CharType, typename PrintPolicy>
+	static void WriteJson(const ContainerType& Container, TJsonWriter<CharType, PrintPolicy>& Writer)
+	{
+		Details::DerefIfPointer(Container, [&](const auto& Derefed)
+		{
+			Details::TJsonExporter<CharType, PrintPolicy>{ Writer }.WriteStruct(Details::GetUStructOf(Derefed), &Derefed);
+		});
+	}
+
+	/**
+	 * 객체 하나를 압축된 JSON 문자열로 씁니다.
+	 * OutJson의 기존 내용은 지워지지만 할당된 메모리는 유지되므로 같은 FString을 재사용하면 매번 할당하지 않습니다.
+	 * 
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param OutJson 결과를 받을 문자열
+	 */
+	template <typename ContainerType>
+	static void WriteJson(const ContainerType& Container, FString& OutJson)
+	{
+		OutJson.Reset();
+
+		const auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJson);
+		WriteJson(Container, *Writer);
+		Writer->Close();
+	}
+
+	/**
+	 * Reader에서 JSON 객체 하나를 읽어 이름이 같은 멤버에 값을 바로 씁니다. WriteJson의 역방향입니다.
+	 * 중간 FJsonObject를 만들지 않고 토큰을 읽는 대로 처리하며, 키는 UStruct 별로 캐시해 둔 FName 테이블로 찾습니다.
+	 * 키를 FName으로 바꿀 때 없는 이름은 새로 등록하지 않으며, 이름은 대소문자를 구분하지 않습니다.
+	 * 
+	 * 숫자 / bool 원소로 이루어진 TArray는 원소들을 임시 버퍼에 모았다가 한 번에 크기를 맞춰 복사합니다.
+	 * JSON에 있는 TArray, TSet, TMap은 기존 내용을 대체하며, JSON에 없는 멤버는 그대로 둡니다.
+	 * 
+	 * 모르는 키는 건너뜁니다. 값의 종류가 멤버 타입과 맞지 않으면 그 값을 건너뛰고 나머지를 계속 읽은 뒤 false를 반환합니다.
+	 * null은 UObject* / Soft 포인터 멤버를 비우고, 그 외의 멤버는 그대로 둡니다.
+	 * 
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Reader 다음 토큰이 JSON 객체의 시작인 Reader
+	 * @return JSON이 잘못되었거나, 타입이 맞지 않는 값이 있었거나, Container가 유효하지 않으면 false
+	 */
+	template <typename ContainerType>
+	static bool ReadJson(ContainerType&& Container, TJsonReader<TCHAR>& Reader)
+	{
+		bool bSucceeded = false;
+
+		Details::DerefIfPointer(Container, [&](auto& Derefed)
+		{
+			static_assert(!std::is_const_v<std::remove_reference_t<decltype(Derefed)>>, "const 객체에는 쓸 수 없습니다");
+			bSucceeded = Details::ReadJson(Details::GetUStructOf(Derefed), &Derefed, Reader);
 		});
+
+		return bSucceeded;
+	}
+
+	/**
+	 * JSON 문자열에서 객체 하나를 읽어 멤버에 씁니다.
+	 * 
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Json JSON 객체 문자열
+	 */
+	template <typename ContainerType>
+	static bool ReadJson(ContainerType&& Container, const FString& Json)
+	{
+		const auto Reader = TJsonReaderFactory<TCHAR>::Create(Json);
+		return ReadJson(Container, *Reader);
+	}
+
+	/**
+	 * 객체의 멤버들이 소유한 힙 메모리를 할당된 바이트와 사용 중인 바이트로 나누어 멤버 별, UClass 별로 집계합니다.
+	 * 할당된 바이트와 사용 중인 바이트의 차이가 TArray, TMap, TSet, FString의 Slack입니다.
+	 * 
+	 * 컨테이너의 원소가 소유한 메모리(TArray<FString>의 문자열 등)는 항상 포함하며,
+	 * 구조체 멤버 / 구조체 원소와 UObject* 멤버는 Options에 따라 따라갑니다.
+	 * TSet / TMap은 원소 배열만 집계하며 해시 버킷은 포함하지 않습니다.
+	 * 
+	 * 같은 측정을 살아있는 모든 객체에 대해 하려면 콘솔 명령 ReflectionHelper.MeasureMemory <UClass 이름>을 사용합니다.
+	 * 
+	 * @param Container UObject를 상속하는 객체 또는 USTRUCT()로 선언된 구조체 객체를 레퍼런스 또는 포인터로 넘김
+	 * @param Options 구조체와 UObject*를 따라갈 깊이 등
+	 * @return Container가 유효하지 않은 포인터이면 빈 결과
+	 */
+	template <typename ContainerType>
+	static FReflectionMemoryReport MeasureMemory(const ContainerType& Container, const FReflectionDeepIterationOptions& Options = {})
+	{
+		FReflectionMemoryReport Report;
+
+		Details::DerefIfPointer(Container, [&](const auto& Derefed)
+		{
+			Details::MeasureMemory(Details::GetUStructOf(Derefed), &Derefed, Options, Report);
+		});
+
+		return Report;
+	}
+
+	/**
+	 * 여러 컨테이너의 TArray, TSet, TMap, FString 멤버들의 Slack을 회수합니다.
+	 * 오래 실행되는 서버에서 로드 후 한 번 호출해서 상주 메모리를 줄이는 용도입니다.
+	 * 
+	 * TArray와 FString은 Shrink 하고, 구멍이 있는 TSet / TMap은 빈틈 없는 복사본을 만들어 바꿔치기합니다.
+	 * 구조체 멤버와 컨테이너의 원소(TArray<FString>의 문자열 등)도 재귀적으로 처리합니다.
+	 * 컨테이너들은 여러 워커 스레드에서 나누어 처리하므로 순회 도중에 GC가 돌지 않도록 게임 스레드에서 호출해야 하며,
+	 * 그 동안 다른 스레드가 해당 컨테이너에 접근해서는 안 됩니다.
+	 * 
+	 * @param Containers UObject를 상속하는 객체에 대한 포인터 또는 USTRUCT()로 선언된 구조체 객체들
+	 * @return 회수한 바이트 수 (TSet / TMap의 해시 버킷은 포함하지 않음)
+	 */
+	template <typename ContainerType>
+	static int64 ShrinkMembers(TArrayView<ContainerType> Containers)
+	{
+		TArray<TPair<const UStruct*, void*>> Targets;
+		Targets.Reserve(Containers.Num());
+
+		for (ContainerType& Each : Containers)
+		{
+			Details::DerefIfPointer(Each, [&](auto& Derefed)
+			{
+				static_assert(!std::is_const_v<std::remove_reference_t<decltype(Derefed)>>, "const 객체는 Shrink 할 수 없습니다");
+				Targets.Emplace(Details::GetUStructOf(Derefed), &Derefed);
+			});
+		}
+
+		return Details::ShrinkMembers(Targets);
+	}
+
+	/**
+	 * 여러 UObject에 대한 ForEachMember를 여러 프레임에 나누어 수행하는 객체를 만듭니다.
+	 * 한 프레임에 모든 객체를 순회할 수 없을 때 매 프레임 정해진 시간만큼만 순회하는 용도입니다.
+	 * 
+	 * ex)
+	 * auto Visitor = FReflectionHelper::MakeSlicedVisitor(MakeArrayView(Components), [](float& Each) { ... });
+	 * 
+	 * // 매 프레임
+	 * if (Visitor.Tick(0.5))
+	 * {
+	 *     // 모두 순회함
+	 * }
+	 * 
+	 * @tparam ObjectType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Objects UObject를 상속하는 객체에 대한 포인터들
+	 * @param Func 방문되는 멤버가 유일한 파라미터인 Unary Function, 반환된 객체가 복사해서 들고 있음
+	 */
+	template <typename ObjectType, typename FuncType>
+	static auto MakeSlicedVisitor(TArrayView<ObjectType*> Objects, FuncType&& Func)
+	{
+		static_assert(Details::CUObject<ObjectType>, "GC 될 수 있는 UObject만 나누어 순회할 수 있습니다");
+
+		using TypeToIterate = std::decay_t<typename Details::TGetFirstParam<FuncType>::Type>;
+		return TReflectionSlicedVisitor<TypeToIterate, ObjectType, std::decay_t<FuncType>>{ Objects, Forward<FuncType>(Func) };
+	}
+
+	/**
+	 * 여러 컨테이너의 TSoftObjectPtr, TSoftClassPtr, FSoftObjectPtr 멤버들이 가리키는 애셋을 한 번의 비동기 로드 요청으로 불러옵니다.
+	 * 직속 멤버와 TArray, TSet, TMap의 원소를 모두 모으며, 같은 경로는 한 번만 요청합니다.
+	 * 멤버마다 LoadSynchronous()를 호출하는 것과 달리 게임 스레드를 막지 않습니다.
+	 * 
+	 * ex)
+	 * FReflectionHelper::AsyncLoadSoftMembers(MakeArrayView(Actors), [](const FSoftObjectPath& Path)
+	 * {
+	 *     return !Path.GetLongPackageName().StartsWith(TEXT("/Game/Debug"));
+	 * },
+	 * []()
+	 * {
+	 *     // 모두 로드됨
+	 * });
+	 * 
+	 * @tparam ContainerType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam FilterType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @tparam OnLoadedType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Containers UObject를 상속하는 객체에 대한 포인터 또는 USTRUCT()로 선언된 구조체 객체들
+	 * @param Filter const FSoftObjectPath&를 받아 로드할지 여부를 반환하는 함수
+	 * @param OnLoaded 모든 애셋이 로드되면 게임 스레드에서 호출되는 함수
+	 * @param Priority 비동기 로드 우선순위
+	 * @return 로드 요청의 핸들, 로드할 경로가 하나도 없으면 OnLoaded를 바로 호출하고 nullptr 반환
+	 */
+	template <typename ContainerType, typename FilterType, typename OnLoadedType>
+	static TSharedPtr<FStreamableHandle> AsyncLoadSoftMembers(
+		TArrayView<ContainerType> Containers,
+		FilterType&& Filter,
+		OnLoadedType&& OnLoaded,
+		TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority)
+	{
+		using DerefedType = std::remove_pointer_t<ContainerType>;
+
+		TArray<DerefedType*> DerefedContainers;
+		DerefedContainers.Reserve(Containers.Num());
+
+		for (ContainerType& Each : Containers)
+		{
+			Details::DerefIfPointer(Each, [&](auto& Derefed)
+			{
+				DerefedContainers.Add(&Derefed);
+			});
+		}
+
+		TArray<FSoftObjectPath> Paths;
+		TSet<FSoftObjectPath> VisitedPaths;
+
+		const auto Collect = [&](const FSoftObjectPtr& Each)
+		{
+			const FSoftObjectPath& Path = Each.ToSoftObjectPath();
+			if (Path.IsNull() || !Filter(Path))
+			{
+				return;
+			}
+
+			bool bAlreadyVisited = false;
+			VisitedPaths.Add(Path, &bAlreadyVisited);
+			if (!bAlreadyVisited)
+			{
+				Paths.Add(Path);
+			}
+		};
+
+		Details::TFieldIterationHelper<FSoftObjectPtr>::ForEachBatch(MakeArrayView(DerefedContainers), Collect);
+
+		for (DerefedType* Each : DerefedContainers)
+		{
+			Details::TElementIterationHelper<FSoftObjectPtr>::ForEach(*Each, Collect);
+		}
+
+		if (Paths.IsEmpty())
+		{
+			OnLoaded();
+			return nullptr;
+		}
+
+		return Details::GetStreamableManager().RequestAsyncLoad(
+			MoveTemp(Paths), FStreamableDelegate::CreateLambda(Forward<OnLoadedType>(OnLoaded)), Priority);
+	}
+
+	/**
+	 * Structs의 TargetCPPTypes 멤버 Layout을 미리 만들어서 처음 ForEachMember 할 때의 Property 목록 탐색을 없앱니다.
+	 * 게임 시작 시 로딩 화면 등에서 호출하는 용도입니다.
+	 * CacheFileName을 넘기면 Saved 폴더의 해당 파일에 계산 결과를 저장해 두었다가 다음 실행에서 재사용합니다.
+	 * UStruct의 멤버 구성이 바뀌었으면 해당 UStruct만 다시 계산해서 파일을 갱신합니다.
+	 * 
+	 * ex)
+	 * FReflectionHelper::PrewarmLayouts<int32, float, FString>(Structs, TEXT("ReflectionLayouts.bin"));
+	 * 
+	 * @tparam TargetCPPTypes 미리 만들 멤버 타입들
+	 * @param Structs Layout을 만들 UStruct들
+	 * @param CacheFileName Saved 폴더 기준의 캐시 파일 경로, nullptr이면 파일을 쓰지 않음
+	 * @return 캐시 파일에서 읽어서 만든 Layout의 수
+	 */
+	template <typename... TargetCPPTypes>
+	static int32 PrewarmLayouts(TConstArrayView<const UStruct*> Structs, const TCHAR* CacheFileName = nullptr)
+	{
+		static_assert(sizeof...(TargetCPPTypes) > 0, "미리 만들 멤버 타입을 하나 이상 넘겨야 합니다");
+
+		const double StartSeconds = FPlatformTime::Seconds();
+
+		TOptional<Details::FPersistentLayoutCache> PersistentCache;
+		if (CacheFileName)
+		{
+			PersistentCache.Emplace(FPaths::ProjectSavedDir() / CacheFileName);
+		}
+
+		int32 NumLayouts = 0;
+		int32 NumLoadedLayouts = 0;
+		for (const UStruct* Struct : Structs)
+		{
+			if (!Struct)
+			{
+				continue;
+			}
+
+			NumLayouts += sizeof...(TargetCPPTypes);
+			((NumLoadedLayouts += Details::TFieldIterationHelper<TargetCPPTypes>::Prewarm(Struct, PersistentCache.GetPtrOrNull()) ? 1 : 0), ...);
+		}
+
+		if (PersistentCache && !PersistentCache->Save())
+		{
+			UE_LOG(LogReflectionHelper, Warning, TEXT("레이아웃 캐시 파일을 쓰지 못했습니다: %s"), CacheFileName);
+		}
+
+		UE_LOG(LogReflectionHelper, Log, TEXT("Prewarmed %d layouts (%d from cache file) of %d structs in %.2f ms"),
+			NumLayouts, NumLoadedLayouts, Structs.Num(), (FPlatformTime::Seconds() - StartSeconds) * 1000.);
+
+		return NumLoadedLayouts;
+	}
+
+	/**
+	 * 모듈에 선언된 모든 UClass와 USTRUCT()에 대해 PrewarmLayouts를 호출합니다.
+	 * 
+	 * ex)
+	 * FReflectionHelper::PrewarmModuleLayouts<int32, float, bool>(TEXT("ReflectionDemo"), TEXT("ReflectionLayouts.bin"));
+	 * 
+	 * @param ModuleName /Script/ 뒤에 붙는 모듈 이름
+	 * @return 캐시 파일에서 읽어서 만든 Layout의 수
+	 */
+	template <typename... TargetCPPTypes>
+	static int32 PrewarmModuleLayouts(FName ModuleName, const TCHAR* CacheFileName = nullptr)
+	{
+		return PrewarmLayouts<TargetCPPTypes...>(Details::GetStructsInModule(ModuleName), CacheFileName);
+	}
+
+	/**
+	 * Root에서 UObject 참조 멤버들을 따라 도달할 수 있는 모든 객체를 한 번씩 방문합니다 (Root 포함).
+	 * 직속 멤버뿐만 아니라 구조체 멤버, TArray, TSet, TMap 안에 있는 UObject*, TObjectPtr, TScriptInterface도 따라가며
+	 * Weak, Lazy, Soft 참조는 따라가지 않습니다.
+	 * 
+	 * 클래스 별로 참조 멤버의 오프셋 목록을 한 번만 만들어 두고(중첩된 구조체 멤버는 평탄화됨),
+	 * 같은 거리에 있는 객체들(frontier)을 ParallelFor로 나누어 처리하는 너비 우선 탐색을 합니다.
+	 * 방문 여부는 GUObjectArray 인덱스로 접근하는 lock-free 비트셋에 기록하므로 객체가 많아도 해시 테이블이 커지지 않습니다.
+	 * 탐색하는 동안에는 GC가 실행되지 않습니다.
+	 * 
+	 * ex)
+	 * std::atomic<int32> NumTextures = 0;
+	 * FReflectionHelper::VisitReachable(Level, [&](UObject* Each) { if (Each->IsA<UTexture>()) NumTextures++; });
+	 * 
+	 * @tparam FuncType Deduced Parameter이므로 명시적으로 넘기지 않음
+	 * @param Root 탐색을 시작할 객체
+	 * @param Func 방문되는 객체가 유일한 파라미터인 Unary Function, 여러 워커 스레드에서 동시에 호출되므로 thread-safe 해야 함
+	 *             bool을 반환하면 false를 반환한 객체의 멤버는 따라가지 않음
+	 */
+	template <typename FuncType>
+	static void VisitReachable(UObject* Root, FuncType&& Func)
+	{
+		if (!Details::IsValidPointer(Root))
+		{
+			return;
+		}
+
+		Details::VisitReachable(Root, [&](UObject* Each)
+		{
+			if constexpr (std::is_same_v<std::invoke_result_t<FuncType&, UObject*>, bool>)
+			{
+				return Func(Each);
+			}
+			else
+			{
+				Func(Each);
+				return true;
+			}
+		});
+	}
+
+	/**
+	 * ForEachMember 계열 함수들이 캐시해 둔 멤버 오프셋 정보를 모두 폐기합니다.
+	 * Hot Reload / Live Coding 시에는 자동으로 호출되므로 직접 호출할 일은 거의 없습니다.
+	 */
+	static void InvalidateLayoutCache()
+	{
+		Details::FReflectionLayoutCache::Get().Invalidate();
 	}
 };
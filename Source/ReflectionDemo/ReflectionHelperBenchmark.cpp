@@ -0,0 +1,539 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ReflectionHelperBenchmark.h"
+
+#include "ReflectionHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogReflectionHelperBenchmark, Log, All);
+
+
+namespace
+{
+	/**
+	 * 측정 중인 스레드에서 일어난 힙 할당 횟수를 세기 위해 GMalloc을 감싸는 Proxy
+	 * 할당 자체는 모두 원래의 GMalloc으로 넘기므로 감싸기 전후에 할당된 메모리를 섞어서 해제해도 안전합니다.
+	 * 횟수는 스레드 별로 세므로 다른 스레드의 할당은 측정에 섞이지 않습니다.
+	 * 스레드 별 캐시와 통계 같은 나머지 가상 함수도 모두 넘겨야 감싼 뒤에 만들어진 스레드가 원래와 같은 조건에서 할당합니다.
+	 */
+	class FAllocationCountingMalloc final : public FMalloc
+	{
+	public:
+		static inline thread_local int64 NumAllocations = 0;
+
+		explicit FAllocationCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+		{
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			++NumAllocations;
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			++NumAllocations;
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// Count가 0이면 해제이므로 세지 않음
+			NumAllocations += Count > 0 ? 1 : 0;
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			NumAllocations += Count > 0 ? 1 : 0;
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			Inner->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return Inner->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return Inner->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			Inner->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			Inner->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void MarkTLSCachesAsUsedOnCurrentThread() override
+		{
+			Inner->MarkTLSCachesAsUsedOnCurrentThread();
+		}
+
+		virtual void MarkTLSCachesAsUnusedOnCurrentThread() override
+		{
+			Inner->MarkTLSCachesAsUnusedOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			Inner->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual void InitializeStatsMetadata() override
+		{
+			Inner->InitializeStatsMetadata();
+		}
+
+		virtual void UpdateStats() override
+		{
+			Inner->UpdateStats();
+		}
+
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+		{
+			Inner->GetAllocatorStats(OutStats);
+		}
+
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override
+		{
+			Inner->DumpAllocatorStats(Ar);
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return Inner->ValidateHeap();
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return Inner->IsInternallyThreadSafe();
+		}
+
+		virtual void OnMallocInitialized() override
+		{
+			Inner->OnMallocInitialized();
+		}
+
+		virtual void OnPreFork() override
+		{
+			Inner->OnPreFork();
+		}
+
+		virtual void OnPostFork() override
+		{
+			Inner->OnPostFork();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return TEXT("AllocationCountingMalloc");
+		}
+
+	private:
+		FMalloc* Inner;
+	};
+
+	/**
+	 * GMalloc을 FAllocationCountingMalloc으로 한 번만 바꿔 끼우고 되돌리지 않습니다.
+	 * 워커 스레드들이 언제 GMalloc을 읽었는지 알 수 없으므로 측정 구간마다 바꿔 끼우거나
+	 * Proxy를 먼저 해제하면 다른 스레드가 해제된 Proxy를 호출할 수 있습니다. 그래서 Proxy는 프로세스가 끝날 때까지 살려 둡니다.
+	 */
+	void InstallAllocationCounter()
+	{
+		static bool bInstalled = false;
+		if (bInstalled)
+		{
+			return;
+		}
+		bInstalled = true;
+
+		FAllocationCountingMalloc* Proxy = new FAllocationCountingMalloc(GMalloc);
+		FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), Proxy);
+	}
+
+
+	struct FMeasurement
+	{
+		double NanosecondsPerRepeat;
+		double AllocationsPerRepeat;
+	};
+
+	/**
+	 * Body를 일정 시간 이상 반복 실행하여 1회 당 평균 시간과 할당 횟수를 구합니다.
+	 * Setup은 매 반복 전에 실행되며 측정에서 제외됩니다.
+	 */
+	template <typename SetupType, typename BodyType>
+	FMeasurement Measure(SetupType&& Setup, BodyType&& Body)
+	{
+		constexpr double MinSeconds = 0.02;
+		constexpr int32 MinRepeats = 3;
+		constexpr int32 MaxRepeats = 100000;
+
+		// 워밍업
+		Setup();
+		Body();
+
+		uint64 Cycles = 0;
+		int64 Allocations = 0;
+		int32 Repeats = 0;
+
+		while (Repeats < MinRepeats || (Repeats < MaxRepeats && FPlatformTime::ToSeconds64(Cycles) < MinSeconds))
+		{
+			Setup();
+
+			const int64 AllocationsBefore = FAllocationCountingMalloc::NumAllocations;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			Body();
+
+			Cycles += FPlatformTime::Cycles64() - StartCycles;
+			Allocations += FAllocationCountingMalloc::NumAllocations - AllocationsBefore;
+			++Repeats;
+		}
+
+		return { FPlatformTime::ToMilliseconds64(Cycles) * 1000000.0 / Repeats, static_cast<double>(Allocations) / Repeats };
+	}
+
+
+	struct FBenchmarkRow
+	{
+		FString Method;
+		FString Type;
+		int32 NumProperties;
+		double MatchRatio;
+		int32 NumContainers;
+		FString Cache;
+		double NanosecondsPerMember;
+		double AllocationsPerCall;
+	};
+
+	struct FBenchmarkOptions
+	{
+		TArray<int32> ContainerCounts;
+
+		/** -Reachability에서 만들 객체 수들 */
+		TArray<int32> ObjectCounts;
+
+		/** 컨테이너 배열 하나가 차지할 수 있는 최대 크기 (500개짜리 구조체 10만개 같은 조합은 건너뜀) */
+		SIZE_T MaxBytes = 64 * 1024 * 1024;
+	};
+
+	// 순회 결과를 여기에 더해서 컴파일러가 순회 자체를 제거하지 못하게 함
+	double GSink = 0.;
+
+
+	template <typename StructType, typename TargetCPPType>
+	void RunCase(TArray<StructType>& Containers, const TCHAR* TypeName, TArray<FBenchmarkRow>& OutRows)
+	{
+		using TargetFPropertyType = typename Details::TGetFPropertyTypeFromCPPType<TargetCPPType>::Type;
+
+		const UStruct* Struct = StructType::StaticStruct();
+		const int32 NumContainers = Containers.Num();
+
+		int32 NumProperties = 0;
+		for (TFieldIterator<FProperty> It{ Struct }; It; ++It)
+		{
+			NumProperties++;
+		}
+
+		int32 NumMatches = 0;
+		StructType{}.template ForEachDirect<TargetCPPType>([&](TargetCPPType&)
+		{
+			NumMatches++;
+		});
+
+		const auto Visit = [](const TargetCPPType& Each)
+		{
+			GSink += Each;
+		};
+
+		const auto AddRow = [&](const TCHAR* Method, const TCHAR* Cache, const FMeasurement& Measurement, int32 NumCalls)
+		{
+			const double NumVisited = static_cast<double>(NumContainers) * FMath::Max(1, NumMatches);
+
+			FBenchmarkRow& Row = OutRows.Add_GetRef({
+				Method,
+				TypeName,
+				NumProperties,
+				static_cast<double>(NumMatches) / NumProperties,
+				NumContainers,
+				Cache,
+				Measurement.NanosecondsPerRepeat / NumVisited,
+				Measurement.AllocationsPerRepeat / NumCalls });
+
+			UE_LOG(LogReflectionHelperBenchmark, Display, TEXT("%-20s %-6s props=%4d match=%5.1f%% containers=%6d cache=%-4s %10.3f ns/member %8.3f allocs/call"),
+				*Row.Method, *Row.Type, Row.NumProperties, Row.MatchRatio * 100., Row.NumContainers, *Row.Cache, Row.NanosecondsPerMember, Row.AllocationsPerCall);
+		};
+
+		const auto NoSetup = []() {};
+		const auto InvalidateCache = []() { FReflectionHelper::InvalidateLayoutCache(); };
+
+		const auto ForEachMember = [&]()
+		{
+			for (StructType& Each : Containers)
+			{
+				FReflectionHelper::ForEachMember(Each, Visit);
+			}
+		};
+
+		const auto ForEachMemberBatch = [&]()
+		{
+			FReflectionHelper::ForEachMemberBatch(MakeArrayView(Containers), Visit);
+		};
+
+		// readme의 MuteAll과 같은 형태
+		const auto FieldIterator = [&]()
+		{
+			for (StructType& Each : Containers)
+			{
+				for (TFieldIterator<TargetFPropertyType> It{ Struct }; It; ++It)
+				{
+					Visit(*It->template ContainerPtrToValuePtr<TargetCPPType>(&Each));
+				}
+			}
+		};
+
+		const auto Direct = [&]()
+		{
+			for (StructType& Each : Containers)
+			{
+				Each.template ForEachDirect<TargetCPPType>(Visit);
+			}
+		};
+
+		AddRow(TEXT("ForEachMember"), TEXT("Warm"), Measure(NoSetup, ForEachMember), NumContainers);
+		AddRow(TEXT("ForEachMember"), TEXT("Cold"), Measure(InvalidateCache, ForEachMember), NumContainers);
+		AddRow(TEXT("ForEachMemberBatch"), TEXT("Warm"), Measure(NoSetup, ForEachMemberBatch), 1);
+		AddRow(TEXT("ForEachMemberBatch"), TEXT("Cold"), Measure(InvalidateCache, ForEachMemberBatch), 1);
+		AddRow(TEXT("TFieldIterator"), TEXT("-"), Measure(NoSetup, FieldIterator), NumContainers);
+		AddRow(TEXT("Direct"), TEXT("-"), Measure(NoSetup, Direct), NumContainers);
+	}
+
+	template <typename StructType>
+	void RunStruct(const FBenchmarkOptions& Options, TArray<FBenchmarkRow>& OutRows)
+	{
+		for (const int32 NumContainers : Options.ContainerCounts)
+		{
+			if (sizeof(StructType) * static_cast<SIZE_T>(NumContainers) > Options.MaxBytes)
+			{
+				continue;
+			}
+
+			TArray<StructType> Containers;
+			Containers.SetNum(NumContainers);
+
+			RunCase<StructType, int32>(Containers, TEXT("int32"), OutRows);
+			RunCase<StructType, float>(Containers, TEXT("float"), OutRows);
+			RunCase<StructType, int16>(Containers, TEXT("int16"), OutRows);
+		}
+	}
+
+	/**
+	 * 처음 실행할 때처럼 Layout이 하나도 없는 상태에서 모듈의 모든 UStruct를 PrewarmModuleLayouts 하는 시간을 잽니다.
+	 * 캐시 파일 없이, 캐시 파일을 새로 쓰면서, 캐시 파일에서 읽으면서의 세 경우를 비교합니다.
+	 * 행의 NumProperties에는 UStruct 수, NsPerMember에는 UStruct 하나 당 시간을 기록합니다.
+	 */
+	void RunColdStart(TArray<FBenchmarkRow>& OutRows)
+	{
+		const FName ModuleName = TEXT("ReflectionDemo");
+		const TCHAR* CacheFileName = TEXT("Benchmarks/ReflectionHelperBenchmarkLayouts.bin");
+		const FString CacheFilePath = FPaths::ProjectSavedDir() / CacheFileName;
+
+		const int32 NumStructs = Details::GetStructsInModule(ModuleName).Num();
+		int32 NumLoadedLayouts = 0;
+
+		const auto Prewarm = [&](const TCHAR* FileName)
+		{
+			return [&NumLoadedLayouts, &ModuleName, FileName]()
+			{
+				NumLoadedLayouts = FReflectionHelper::PrewarmModuleLayouts<int32, float, int16>(ModuleName, FileName);
+			};
+		};
+
+		const auto InvalidateCache = []() { FReflectionHelper::InvalidateLayoutCache(); };
+		const auto InvalidateCacheAndFile = [&]()
+		{
+			FReflectionHelper::InvalidateLayoutCache();
+			IFileManager::Get().Delete(*CacheFilePath, false, false, true);
+		};
+
+		const auto AddRow = [&](const TCHAR* Cache, const FMeasurement& Measurement)
+		{
+			FBenchmarkRow& Row = OutRows.Add_GetRef({
+				TEXT("PrewarmModuleLayouts"),
+				TEXT("int32+float+int16"),
+				NumStructs,
+				0.,
+				1,
+				Cache,
+				Measurement.NanosecondsPerRepeat / FMath::Max(1, NumStructs),
+				Measurement.AllocationsPerRepeat });
+
+			UE_LOG(LogReflectionHelperBenchmark, Display, TEXT("%-20s structs=%4d file=%-4s %10.3f ns/struct %8.3f allocs/call (%d layouts from file)"),
+				*Row.Method, NumStructs, *Row.Cache, Row.NanosecondsPerMember, Row.AllocationsPerCall, NumLoadedLayouts);
+		};
+
+		AddRow(TEXT("None"), Measure(InvalidateCache, Prewarm(nullptr)));
+		AddRow(TEXT("Miss"), Measure(InvalidateCacheAndFile, Prewarm(CacheFileName)));
+		AddRow(TEXT("Hit"), Measure(InvalidateCache, Prewarm(CacheFileName)));
+
+		IFileManager::Get().Delete(*CacheFilePath, false, false, true);
+	}
+
+	/**
+	 * 각 노드가 자식 두 개를 가지는 이진 트리로 연결된 객체들에 대해 VisitReachable 하는 시간을 잽니다.
+	 * 행의 NumContainers에는 객체 수, NsPerMember에는 객체 하나 당 시간을 기록합니다.
+	 */
+	void RunReachability(const FBenchmarkOptions& Options, TArray<FBenchmarkRow>& OutRows)
+	{
+		int32 NumProperties = 0;
+		for (TFieldIterator<FProperty> It{ UReflectionBenchmarkNode::StaticClass() }; It; ++It)
+		{
+			NumProperties++;
+		}
+
+		for (const int32 NumObjects : Options.ObjectCounts)
+		{
+			TArray<UReflectionBenchmarkNode*> Nodes;
+			Nodes.Reserve(NumObjects);
+			for (int32 i = 0; i < NumObjects; ++i)
+			{
+				UReflectionBenchmarkNode* Node = NewObject<UReflectionBenchmarkNode>(GetTransientPackage());
+				if (i > 0)
+				{
+					Node->Parent = Nodes[(i - 1) / 2];
+					Node->Parent->Children.Add(Node);
+				}
+				Nodes.Add(Node);
+			}
+
+			// 측정 중 GC가 돌아도 트리가 사라지지 않도록 루트만 고정
+			Nodes[0]->AddToRoot();
+
+			std::atomic<int32> NumVisited = 0;
+			const auto Visit = [&]()
+			{
+				NumVisited = 0;
+				FReflectionHelper::VisitReachable(Nodes[0], [&](UObject*)
+				{
+					NumVisited.fetch_add(1, std::memory_order_relaxed);
+				});
+			};
+
+			const auto AddRow = [&](const TCHAR* Cache, const FMeasurement& Measurement)
+			{
+				FBenchmarkRow& Row = OutRows.Add_GetRef({
+					TEXT("VisitReachable"),
+					TEXT("UObject"),
+					NumProperties,
+					0.,
+					NumObjects,
+					Cache,
+					Measurement.NanosecondsPerRepeat / NumObjects,
+					Measurement.AllocationsPerRepeat });
+
+				UE_LOG(LogReflectionHelperBenchmark, Display, TEXT("%-20s objects=%8d cache=%-4s %10.3f ns/object %8.3f allocs/call (visited %d)"),
+					*Row.Method, NumObjects, *Row.Cache, Row.NanosecondsPerMember, Row.AllocationsPerCall, NumVisited.load());
+			};
+
+			AddRow(TEXT("Warm"), Measure([]() {}, Visit));
+			AddRow(TEXT("Cold"), Measure([]() { FReflectionHelper::InvalidateLayoutCache(); }, Visit));
+
+			Nodes[0]->RemoveFromRoot();
+			for (UReflectionBenchmarkNode* Node : Nodes)
+			{
+				Node->MarkAsGarbage();
+			}
+			CollectGarbage(RF_NoFlags);
+		}
+	}
+
+	FString ToCsv(const TArray<FBenchmarkRow>& Rows)
+	{
+		FString Result = TEXT("Method,Type,NumProperties,MatchRatio,NumContainers,Cache,NsPerMember,AllocsPerCall\n");
+
+		for (const FBenchmarkRow& Row : Rows)
+		{
+			Result += FString::Printf(TEXT("%s,%s,%d,%.4f,%d,%s,%.4f,%.4f\n"),
+				*Row.Method, *Row.Type, Row.NumProperties, Row.MatchRatio, Row.NumContainers, *Row.Cache, Row.NanosecondsPerMember, Row.AllocationsPerCall);
+		}
+
+		return Result;
+	}
+}
+
+
+UReflectionHelperBenchmarkCommandlet::UReflectionHelperBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UReflectionHelperBenchmarkCommandlet::Main(const FString& Params)
+{
+	InstallAllocationCounter();
+
+	FBenchmarkOptions Options;
+	Options.ContainerCounts = FParse::Param(*Params, TEXT("Quick"))
+		? TArray<int32>{ 1, 100, 1000 }
+		: TArray<int32>{ 1, 100, 1000, 10000, 100000 };
+	Options.ObjectCounts = FParse::Param(*Params, TEXT("Quick"))
+		? TArray<int32>{ 1000, 10000, 100000 }
+		: TArray<int32>{ 1000, 10000, 100000, 1000000 };
+
+	FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / TEXT("ReflectionHelperBenchmark.csv");
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+
+	TArray<FBenchmarkRow> Rows;
+
+	// -ColdStart: 처음 실행할 때의 Layout 생성 비용만 잼
+	if (FParse::Param(*Params, TEXT("ColdStart")))
+	{
+		RunColdStart(Rows);
+	}
+	// -Reachability: 객체 그래프 탐색의 규모 별 비용만 잼
+	else if (FParse::Param(*Params, TEXT("Reachability")))
+	{
+		RunReachability(Options, Rows);
+	}
+	else
+	{
+		RunStruct<FReflectionBenchmarkStruct12>(Options, Rows);
+		RunStruct<FReflectionBenchmarkStruct50>(Options, Rows);
+		RunStruct<FReflectionBenchmarkStruct100>(Options, Rows);
+		RunStruct<FReflectionBenchmarkStruct500>(Options, Rows);
+	}
+
+	UE_LOG(LogReflectionHelperBenchmark, Display, TEXT("Sink: %f"), GSink);
+
+	if (!FFileHelper::SaveStringToFile(ToCsv(Rows), *CsvPath))
+	{
+		UE_LOG(LogReflectionHelperBenchmark, Error, TEXT("Failed to write %s"), *CsvPath);
+		return 1;
+	}
+
+	UE_LOG(LogReflectionHelperBenchmark, Display, TEXT("Wrote %d rows to %s"), Rows.Num(), *CsvPath);
+	return 0;
+}
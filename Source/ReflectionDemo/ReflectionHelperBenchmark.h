@@ -0,0 +1,2804 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ReflectionHelperBenchmark.generated.h"
+
+
+/*
+ * 벤치마크용 구조체들
+ * 멤버 타입은 int32 4개, float 2개, int16 1개, bool 1개의 순서를 반복하므로
+ * 순회할 타입에 따라 전체 멤버 중 일치하는 멤버의 비율이 50%, 25%, 12.5%가 됩니다.
+ * ForEachDirect는 Reflection 없이 멤버에 직접 접근하는 기준 구현입니다.
+ * 이 파일은 Scripts/GenerateReflectionBenchmarkStructs.py로 생성되므로 직접 고치지 말고 스크립트를 고친 뒤 다시 생성합니다.
+ */
+
+USTRUCT()
+struct FReflectionBenchmarkStruct12
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 P0 = 0;
+
+	UPROPERTY()
+	int32 P1 = 0;
+
+	UPROPERTY()
+	int32 P2 = 0;
+
+	UPROPERTY()
+	int32 P3 = 0;
+
+	UPROPERTY()
+	float P4 = 0.f;
+
+	UPROPERTY()
+	float P5 = 0.f;
+
+	UPROPERTY()
+	int16 P6 = 0;
+
+	UPROPERTY()
+	bool P7 = false;
+
+	UPROPERTY()
+	int32 P8 = 0;
+
+	UPROPERTY()
+	int32 P9 = 0;
+
+	UPROPERTY()
+	int32 P10 = 0;
+
+	UPROPERTY()
+	int32 P11 = 0;
+
+	template <typename T, typename FuncType>
+	void ForEachDirect(FuncType&& Func)
+	{
+		if constexpr (std::is_same_v<T, int32>)
+		{
+			Func(P0);
+			Func(P1);
+			Func(P2);
+			Func(P3);
+			Func(P8);
+			Func(P9);
+			Func(P10);
+			Func(P11);
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			Func(P4);
+			Func(P5);
+		}
+		else if constexpr (std::is_same_v<T, int16>)
+		{
+			Func(P6);
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			Func(P7);
+		}
+	}
+};
+
+
+USTRUCT()
+struct FReflectionBenchmarkStruct50
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 P0 = 0;
+
+	UPROPERTY()
+	int32 P1 = 0;
+
+	UPROPERTY()
+	int32 P2 = 0;
+
+	UPROPERTY()
+	int32 P3 = 0;
+
+	UPROPERTY()
+	float P4 = 0.f;
+
+	UPROPERTY()
+	float P5 = 0.f;
+
+	UPROPERTY()
+	int16 P6 = 0;
+
+	UPROPERTY()
+	bool P7 = false;
+
+	UPROPERTY()
+	int32 P8 = 0;
+
+	UPROPERTY()
+	int32 P9 = 0;
+
+	UPROPERTY()
+	int32 P10 = 0;
+
+	UPROPERTY()
+	int32 P11 = 0;
+
+	UPROPERTY()
+	float P12 = 0.f;
+
+	UPROPERTY()
+	float P13 = 0.f;
+
+	UPROPERTY()
+	int16 P14 = 0;
+
+	UPROPERTY()
+	bool P15 = false;
+
+	UPROPERTY()
+	int32 P16 = 0;
+
+	UPROPERTY()
+	int32 P17 = 0;
+
+	UPROPERTY()
+	int32 P18 = 0;
+
+	UPROPERTY()
+	int32 P19 = 0;
+
+	UPROPERTY()
+	float P20 = 0.f;
+
+	UPROPERTY()
+	float P21 = 0.f;
+
+	UPROPERTY()
+	int16 P22 = 0;
+
+	UPROPERTY()
+	bool P23 = false;
+
+	UPROPERTY()
+	int32 P24 = 0;
+
+	UPROPERTY()
+	int32 P25 = 0;
+
+	UPROPERTY()
+	int32 P26 = 0;
+
+	UPROPERTY()
+	int32 P27 = 0;
+
+	UPROPERTY()
+	float P28 = 0.f;
+
+	UPROPERTY()
+	float P29 = 0.f;
+
+	UPROPERTY()
+	int16 P30 = 0;
+
+	UPROPERTY()
+	bool P31 = false;
+
+	UPROPERTY()
+	int32 P32 = 0;
+
+	UPROPERTY()
+	int32 P33 = 0;
+
+	UPROPERTY()
+	int32 P34 = 0;
+
+	UPROPERTY()
+	int32 P35 = 0;
+
+	UPROPERTY()
+	float P36 = 0.f;
+
+	UPROPERTY()
+	float P37 = 0.f;
+
+	UPROPERTY()
+	int16 P38 = 0;
+
+	UPROPERTY()
+	bool P39 = false;
+
+	UPROPERTY()
+	int32 P40 = 0;
+
+	UPROPERTY()
+	int32 P41 = 0;
+
+	UPROPERTY()
+	int32 P42 = 0;
+
+	UPROPERTY()
+	int32 P43 = 0;
+
+	UPROPERTY()
+	float P44 = 0.f;
+
+	UPROPERTY()
+	float P45 = 0.f;
+
+	UPROPERTY()
+	int16 P46 = 0;
+
+	UPROPERTY()
+	bool P47 = false;
+
+	UPROPERTY()
+	int32 P48 = 0;
+
+	UPROPERTY()
+	int32 P49 = 0;
+
+	template <typename T, typename FuncType>
+	void ForEachDirect(FuncType&& Func)
+	{
+		if constexpr (std::is_same_v<T, int32>)
+		{
+			Func(P0);
+			Func(P1);
+			Func(P2);
+			Func(P3);
+			Func(P8);
+			Func(P9);
+			Func(P10);
+			Func(P11);
+			Func(P16);
+			Func(P17);
+			Func(P18);
+			Func(P19);
+			Func(P24);
+			Func(P25);
+			Func(P26);
+			Func(P27);
+			Func(P32);
+			Func(P33);
+			Func(P34);
+			Func(P35);
+			Func(P40);
+			Func(P41);
+			Func(P42);
+			Func(P43);
+			Func(P48);
+			Func(P49);
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			Func(P4);
+			Func(P5);
+			Func(P12);
+			Func(P13);
+			Func(P20);
+			Func(P21);
+			Func(P28);
+			Func(P29);
+			Func(P36);
+			Func(P37);
+			Func(P44);
+			Func(P45);
+		}
+		else if constexpr (std::is_same_v<T, int16>)
+		{
+			Func(P6);
+			Func(P14);
+			Func(P22);
+			Func(P30);
+			Func(P38);
+			Func(P46);
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			Func(P7);
+			Func(P15);
+			Func(P23);
+			Func(P31);
+			Func(P39);
+			Func(P47);
+		}
+	}
+};
+
+
+USTRUCT()
+struct FReflectionBenchmarkStruct100
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 P0 = 0;
+
+	UPROPERTY()
+	int32 P1 = 0;
+
+	UPROPERTY()
+	int32 P2 = 0;
+
+	UPROPERTY()
+	int32 P3 = 0;
+
+	UPROPERTY()
+	float P4 = 0.f;
+
+	UPROPERTY()
+	float P5 = 0.f;
+
+	UPROPERTY()
+	int16 P6 = 0;
+
+	UPROPERTY()
+	bool P7 = false;
+
+	UPROPERTY()
+	int32 P8 = 0;
+
+	UPROPERTY()
+	int32 P9 = 0;
+
+	UPROPERTY()
+	int32 P10 = 0;
+
+	UPROPERTY()
+	int32 P11 = 0;
+
+	UPROPERTY()
+	float P12 = 0.f;
+
+	UPROPERTY()
+	float P13 = 0.f;
+
+	UPROPERTY()
+	int16 P14 = 0;
+
+	UPROPERTY()
+	bool P15 = false;
+
+	UPROPERTY()
+	int32 P16 = 0;
+
+	UPROPERTY()
+	int32 P17 = 0;
+
+	UPROPERTY()
+	int32 P18 = 0;
+
+	UPROPERTY()
+	int32 P19 = 0;
+
+	UPROPERTY()
+	float P20 = 0.f;
+
+	UPROPERTY()
+	float P21 = 0.f;
+
+	UPROPERTY()
+	int16 P22 = 0;
+
+	UPROPERTY()
+	bool P23 = false;
+
+	UPROPERTY()
+	int32 P24 = 0;
+
+	UPROPERTY()
+	int32 P25 = 0;
+
+	UPROPERTY()
+	int32 P26 = 0;
+
+	UPROPERTY()
+	int32 P27 = 0;
+
+	UPROPERTY()
+	float P28 = 0.f;
+
+	UPROPERTY()
+	float P29 = 0.f;
+
+	UPROPERTY()
+	int16 P30 = 0;
+
+	UPROPERTY()
+	bool P31 = false;
+
+	UPROPERTY()
+	int32 P32 = 0;
+
+	UPROPERTY()
+	int32 P33 = 0;
+
+	UPROPERTY()
+	int32 P34 = 0;
+
+	UPROPERTY()
+	int32 P35 = 0;
+
+	UPROPERTY()
+	float P36 = 0.f;
+
+	UPROPERTY()
+	float P37 = 0.f;
+
+	UPROPERTY()
+	int16 P38 = 0;
+
+	UPROPERTY()
+	bool P39 = false;
+
+	UPROPERTY()
+	int32 P40 = 0;
+
+	UPROPERTY()
+	int32 P41 = 0;
+
+	UPROPERTY()
+	int32 P42 = 0;
+
+	UPROPERTY()
+	int32 P43 = 0;
+
+	UPROPERTY()
+	float P44 = 0.f;
+
+	UPROPERTY()
+	float P45 = 0.f;
+
+	UPROPERTY()
+	int16 P46 = 0;
+
+	UPROPERTY()
+	bool P47 = false;
+
+	UPROPERTY()
+	int32 P48 = 0;
+
+	UPROPERTY()
+	int32 P49 = 0;
+
+	UPROPERTY()
+	int32 P50 = 0;
+
+	UPROPERTY()
+	int32 P51 = 0;
+
+	UPROPERTY()
+	float P52 = 0.f;
+
+	UPROPERTY()
+	float P53 = 0.f;
+
+	UPROPERTY()
+	int16 P54 = 0;
+
+	UPROPERTY()
+	bool P55 = false;
+
+	UPROPERTY()
+	int32 P56 = 0;
+
+	UPROPERTY()
+	int32 P57 = 0;
+
+	UPROPERTY()
+	int32 P58 = 0;
+
+	UPROPERTY()
+	int32 P59 = 0;
+
+	UPROPERTY()
+	float P60 = 0.f;
+
+	UPROPERTY()
+	float P61 = 0.f;
+
+	UPROPERTY()
+	int16 P62 = 0;
+
+	UPROPERTY()
+	bool P63 = false;
+
+	UPROPERTY()
+	int32 P64 = 0;
+
+	UPROPERTY()
+	int32 P65 = 0;
+
+	UPROPERTY()
+	int32 P66 = 0;
+
+	UPROPERTY()
+	int32 P67 = 0;
+
+	UPROPERTY()
+	float P68 = 0.f;
+
+	UPROPERTY()
+	float P69 = 0.f;
+
+	UPROPERTY()
+	int16 P70 = 0;
+
+	UPROPERTY()
+	bool P71 = false;
+
+	UPROPERTY()
+	int32 P72 = 0;
+
+	UPROPERTY()
+	int32 P73 = 0;
+
+	UPROPERTY()
+	int32 P74 = 0;
+
+	UPROPERTY()
+	int32 P75 = 0;
+
+	UPROPERTY()
+	float P76 = 0.f;
+
+	UPROPERTY()
+	float P77 = 0.f;
+
+	UPROPERTY()
+	int16 P78 = 0;
+
+	UPROPERTY()
+	bool P79 = false;
+
+	UPROPERTY()
+	int32 P80 = 0;
+
+	UPROPERTY()
+	int32 P81 = 0;
+
+	UPROPERTY()
+	int32 P82 = 0;
+
+	UPROPERTY()
+	int32 P83 = 0;
+
+	UPROPERTY()
+	float P84 = 0.f;
+
+	UPROPERTY()
+	float P85 = 0.f;
+
+	UPROPERTY()
+	int16 P86 = 0;
+
+	UPROPERTY()
+	bool P87 = false;
+
+	UPROPERTY()
+	int32 P88 = 0;
+
+	UPROPERTY()
+	int32 P89 = 0;
+
+	UPROPERTY()
+	int32 P90 = 0;
+
+	UPROPERTY()
+	int32 P91 = 0;
+
+	UPROPERTY()
+	float P92 = 0.f;
+
+	UPROPERTY()
+	float P93 = 0.f;
+
+	UPROPERTY()
+	int16 P94 = 0;
+
+	UPROPERTY()
+	bool P95 = false;
+
+	UPROPERTY()
+	int32 P96 = 0;
+
+	UPROPERTY()
+	int32 P97 = 0;
+
+	UPROPERTY()
+	int32 P98 = 0;
+
+	UPROPERTY()
+	int32 P99 = 0;
+
+	template <typename T, typename FuncType>
+	void ForEachDirect(FuncType&& Func)
+	{
+		if constexpr (std::is_same_v<T, int32>)
+		{
+			Func(P0);
+			Func(P1);
+			Func(P2);
+			Func(P3);
+			Func(P8);
+			Func(P9);
+			Func(P10);
+			Func(P11);
+			Func(P16);
+			Func(P17);
+			Func(P18);
+			Func(P19);
+			Func(P24);
+			Func(P25);
+			Func(P26);
+			Func(P27);
+			Func(P32);
+			Func(P33);
+			Func(P34);
+			Func(P35);
+			Func(P40);
+			Func(P41);
+			Func(P42);
+			Func(P43);
+			Func(P48);
+			Func(P49);
+			Func(P50);
+			Func(P51);
+			Func(P56);
+			Func(P57);
+			Func(P58);
+			Func(P59);
+			Func(P64);
+			Func(P65);
+			Func(P66);
+			Func(P67);
+			Func(P72);
+			Func(P73);
+			Func(P74);
+			Func(P75);
+			Func(P80);
+			Func(P81);
+			Func(P82);
+			Func(P83);
+			Func(P88);
+			Func(P89);
+			Func(P90);
+			Func(P91);
+			Func(P96);
+			Func(P97);
+			Func(P98);
+			Func(P99);
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			Func(P4);
+			Func(P5);
+			Func(P12);
+			Func(P13);
+			Func(P20);
+			Func(P21);
+			Func(P28);
+			Func(P29);
+			Func(P36);
+			Func(P37);
+			Func(P44);
+			Func(P45);
+			Func(P52);
+			Func(P53);
+			Func(P60);
+			Func(P61);
+			Func(P68);
+			Func(P69);
+			Func(P76);
+			Func(P77);
+			Func(P84);
+			Func(P85);
+			Func(P92);
+			Func(P93);
+		}
+		else if constexpr (std::is_same_v<T, int16>)
+		{
+			Func(P6);
+			Func(P14);
+			Func(P22);
+			Func(P30);
+			Func(P38);
+			Func(P46);
+			Func(P54);
+			Func(P62);
+			Func(P70);
+			Func(P78);
+			Func(P86);
+			Func(P94);
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			Func(P7);
+			Func(P15);
+			Func(P23);
+			Func(P31);
+			Func(P39);
+			Func(P47);
+			Func(P55);
+			Func(P63);
+			Func(P71);
+			Func(P79);
+			Func(P87);
+			Func(P95);
+		}
+	}
+};
+
+
+USTRUCT()
+struct FReflectionBenchmarkStruct500
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 P0 = 0;
+
+	UPROPERTY()
+	int32 P1 = 0;
+
+	UPROPERTY()
+	int32 P2 = 0;
+
+	UPROPERTY()
+	int32 P3 = 0;
+
+	UPROPERTY()
+	float P4 = 0.f;
+
+	UPROPERTY()
+	float P5 = 0.f;
+
+	UPROPERTY()
+	int16 P6 = 0;
+
+	UPROPERTY()
+	bool P7 = false;
+
+	UPROPERTY()
+	int32 P8 = 0;
+
+	UPROPERTY()
+	int32 P9 = 0;
+
+	UPROPERTY()
+	int32 P10 = 0;
+
+	UPROPERTY()
+	int32 P11 = 0;
+
+	UPROPERTY()
+	float P12 = 0.f;
+
+	UPROPERTY()
+	float P13 = 0.f;
+
+	UPROPERTY()
+	int16 P14 = 0;
+
+	UPROPERTY()
+	bool P15 = false;
+
+	UPROPERTY()
+	int32 P16 = 0;
+
+	UPROPERTY()
+	int32 P17 = 0;
+
+	UPROPERTY()
+	int32 P18 = 0;
+
+	UPROPERTY()
+	int32 P19 = 0;
+
+	UPROPERTY()
+	float P20 = 0.f;
+
+	UPROPERTY()
+	float P21 = 0.f;
+
+	UPROPERTY()
+	int16 P22 = 0;
+
+	UPROPERTY()
+	bool P23 = false;
+
+	UPROPERTY()
+	int32 P24 = 0;
+
+	UPROPERTY()
+	int32 P25 = 0;
+
+	UPROPERTY()
+	int32 P26 = 0;
+
+	UPROPERTY()
+	int32 P27 = 0;
+
+	UPROPERTY()
+	float P28 = 0.f;
+
+	UPROPERTY()
+	float P29 = 0.f;
+
+	UPROPERTY()
+	int16 P30 = 0;
+
+	UPROPERTY()
+	bool P31 = false;
+
+	UPROPERTY()
+	int32 P32 = 0;
+
+	UPROPERTY()
+	int32 P33 = 0;
+
+	UPROPERTY()
+	int32 P34 = 0;
+
+	UPROPERTY()
+	int32 P35 = 0;
+
+	UPROPERTY()
+	float P36 = 0.f;
+
+	UPROPERTY()
+	float P37 = 0.f;
+
+	UPROPERTY()
+	int16 P38 = 0;
+
+	UPROPERTY()
+	bool P39 = false;
+
+	UPROPERTY()
+	int32 P40 = 0;
+
+	UPROPERTY()
+	int32 P41 = 0;
+
+	UPROPERTY()
+	int32 P42 = 0;
+
+	UPROPERTY()
+	int32 P43 = 0;
+
+	UPROPERTY()
+	float P44 = 0.f;
+
+	UPROPERTY()
+	float P45 = 0.f;
+
+	UPROPERTY()
+	int16 P46 = 0;
+
+	UPROPERTY()
+	bool P47 = false;
+
+	UPROPERTY()
+	int32 P48 = 0;
+
+	UPROPERTY()
+	int32 P49 = 0;
+
+	UPROPERTY()
+	int32 P50 = 0;
+
+	UPROPERTY()
+	int32 P51 = 0;
+
+	UPROPERTY()
+	float P52 = 0.f;
+
+	UPROPERTY()
+	float P53 = 0.f;
+
+	UPROPERTY()
+	int16 P54 = 0;
+
+	UPROPERTY()
+	bool P55 = false;
+
+	UPROPERTY()
+	int32 P56 = 0;
+
+	UPROPERTY()
+	int32 P57 = 0;
+
+	UPROPERTY()
+	int32 P58 = 0;
+
+	UPROPERTY()
+	int32 P59 = 0;
+
+	UPROPERTY()
+	float P60 = 0.f;
+
+	UPROPERTY()
+	float P61 = 0.f;
+
+	UPROPERTY()
+	int16 P62 = 0;
+
+	UPROPERTY()
+	bool P63 = false;
+
+	UPROPERTY()
+	int32 P64 = 0;
+
+	UPROPERTY()
+	int32 P65 = 0;
+
+	UPROPERTY()
+	int32 P66 = 0;
+
+	UPROPERTY()
+	int32 P67 = 0;
+
+	UPROPERTY()
+	float P68 = 0.f;
+
+	UPROPERTY()
+	float P69 = 0.f;
+
+	UPROPERTY()
+	int16 P70 = 0;
+
+	UPROPERTY()
+	bool P71 = false;
+
+	UPROPERTY()
+	int32 P72 = 0;
+
+	UPROPERTY()
+	int32 P73 = 0;
+
+	UPROPERTY()
+	int32 P74 = 0;
+
+	UPROPERTY()
+	int32 P75 = 0;
+
+	UPROPERTY()
+	float P76 = 0.f;
+
+	UPROPERTY()
+	float P77 = 0.f;
+
+	UPROPERTY()
+	int16 P78 = 0;
+
+	UPROPERTY()
+	bool P79 = false;
+
+	UPROPERTY()
+	int32 P80 = 0;
+
+	UPROPERTY()
+	int32 P81 = 0;
+
+	UPROPERTY()
+	int32 P82 = 0;
+
+	UPROPERTY()
+	int32 P83 = 0;
+
+	UPROPERTY()
+	float P84 = 0.f;
+
+	UPROPERTY()
+	float P85 = 0.f;
+
+	UPROPERTY()
+	int16 P86 = 0;
+
+	UPROPERTY()
+	bool P87 = false;
+
+	UPROPERTY()
+	int32 P88 = 0;
+
+	UPROPERTY()
+	int32 P89 = 0;
+
+	UPROPERTY()
+	int32 P90 = 0;
+
+	UPROPERTY()
+	int32 P91 = 0;
+
+	UPROPERTY()
+	float P92 = 0.f;
+
+	UPROPERTY()
+	float P93 = 0.f;
+
+	UPROPERTY()
+	int16 P94 = 0;
+
+	UPROPERTY()
+	bool P95 = false;
+
+	UPROPERTY()
+	int32 P96 = 0;
+
+	UPROPERTY()
+	int32 P97 = 0;
+
+	UPROPERTY()
+	int32 P98 = 0;
+
+	UPROPERTY()
+	int32 P99 = 0;
+
+	UPROPERTY()
+	float P100 = 0.f;
+
+	UPROPERTY()
+	float P101 = 0.f;
+
+	UPROPERTY()
+	int16 P102 = 0;
+
+	UPROPERTY()
+	bool P103 = false;
+
+	UPROPERTY()
+	int32 P104 = 0;
+
+	UPROPERTY()
+	int32 P105 = 0;
+
+	UPROPERTY()
+	int32 P106 = 0;
+
+	UPROPERTY()
+	int32 P107 = 0;
+
+	UPROPERTY()
+	float P108 = 0.f;
+
+	UPROPERTY()
+	float P109 = 0.f;
+
+	UPROPERTY()
+	int16 P110 = 0;
+
+	UPROPERTY()
+	bool P111 = false;
+
+	UPROPERTY()
+	int32 P112 = 0;
+
+	UPROPERTY()
+	int32 P113 = 0;
+
+	UPROPERTY()
+	int32 P114 = 0;
+
+	UPROPERTY()
+	int32 P115 = 0;
+
+	UPROPERTY()
+	float P116 = 0.f;
+
+	UPROPERTY()
+	float P117 = 0.f;
+
+	UPROPERTY()
+	int16 P118 = 0;
+
+	UPROPERTY()
+	bool P119 = false;
+
+	UPROPERTY()
+	int32 P120 = 0;
+
+	UPROPERTY()
+	int32 P121 = 0;
+
+	UPROPERTY()
+	int32 P122 = 0;
+
+	UPROPERTY()
+	int32 P123 = 0;
+
+	UPROPERTY()
+	float P124 = 0.f;
+
+	UPROPERTY()
+	float P125 = 0.f;
+
+	UPROPERTY()
+	int16 P126 = 0;
+
+	UPROPERTY()
+	bool P127 = false;
+
+	UPROPERTY()
+	int32 P128 = 0;
+
+	UPROPERTY()
+	int32 P129 = 0;
+
+	UPROPERTY()
+	int32 P130 = 0;
+
+	UPROPERTY()
+	int32 P131 = 0;
+
+	UPROPERTY()
+	float P132 = 0.f;
+
+	UPROPERTY()
+	float P133 = 0.f;
+
+	UPROPERTY()
+	int16 P134 = 0;
+
+	UPROPERTY()
+	bool P135 = false;
+
+	UPROPERTY()
+	int32 P136 = 0;
+
+	UPROPERTY()
+	int32 P137 = 0;
+
+	UPROPERTY()
+	int32 P138 = 0;
+
+	UPROPERTY()
+	int32 P139 = 0;
+
+	UPROPERTY()
+	float P140 = 0.f;
+
+	UPROPERTY()
+	float P141 = 0.f;
+
+	UPROPERTY()
+	int16 P142 = 0;
+
+	UPROPERTY()
+	bool P143 = false;
+
+	UPROPERTY()
+	int32 P144 = 0;
+
+	UPROPERTY()
+	int32 P145 = 0;
+
+	UPROPERTY()
+	int32 P146 = 0;
+
+	UPROPERTY()
+	int32 P147 = 0;
+
+	UPROPERTY()
+	float P148 = 0.f;
+
+	UPROPERTY()
+	float P149 = 0.f;
+
+	UPROPERTY()
+	int16 P150 = 0;
+
+	UPROPERTY()
+	bool P151 = false;
+
+	UPROPERTY()
+	int32 P152 = 0;
+
+	UPROPERTY()
+	int32 P153 = 0;
+
+	UPROPERTY()
+	int32 P154 = 0;
+
+	UPROPERTY()
+	int32 P155 = 0;
+
+	UPROPERTY()
+	float P156 = 0.f;
+
+	UPROPERTY()
+	float P157 = 0.f;
+
+	UPROPERTY()
+	int16 P158 = 0;
+
+	UPROPERTY()
+	bool P159 = false;
+
+	UPROPERTY()
+	int32 P160 = 0;
+
+	UPROPERTY()
+	int32 P161 = 0;
+
+	UPROPERTY()
+	int32 P162 = 0;
+
+	UPROPERTY()
+	int32 P163 = 0;
+
+	UPROPERTY()
+	float P164 = 0.f;
+
+	UPROPERTY()
+	float P165 = 0.f;
+
+	UPROPERTY()
+	int16 P166 = 0;
+
+	UPROPERTY()
+	bool P167 = false;
+
+	UPROPERTY()
+	int32 P168 = 0;
+
+	UPROPERTY()
+	int32 P169 = 0;
+
+	UPROPERTY()
+	int32 P170 = 0;
+
+	UPROPERTY()
+	int32 P171 = 0;
+
+	UPROPERTY()
+	float P172 = 0.f;
+
+	UPROPERTY()
+	float P173 = 0.f;
+
+	UPROPERTY()
+	int16 P174 = 0;
+
+	UPROPERTY()
+	bool P175 = false;
+
+	UPROPERTY()
+	int32 P176 = 0;
+
+	UPROPERTY()
+	int32 P177 = 0;
+
+	UPROPERTY()
+	int32 P178 = 0;
+
+	UPROPERTY()
+	int32 P179 = 0;
+
+	UPROPERTY()
+	float P180 = 0.f;
+
+	UPROPERTY()
+	float P181 = 0.f;
+
+	UPROPERTY()
+	int16 P182 = 0;
+
+	UPROPERTY()
+	bool P183 = false;
+
+	UPROPERTY()
+	int32 P184 = 0;
+
+	UPROPERTY()
+	int32 P185 = 0;
+
+	UPROPERTY()
+	int32 P186 = 0;
+
+	UPROPERTY()
+	int32 P187 = 0;
+
+	UPROPERTY()
+	float P188 = 0.f;
+
+	UPROPERTY()
+	float P189 = 0.f;
+
+	UPROPERTY()
+	int16 P190 = 0;
+
+	UPROPERTY()
+	bool P191 = false;
+
+	UPROPERTY()
+	int32 P192 = 0;
+
+	UPROPERTY()
+	int32 P193 = 0;
+
+	UPROPERTY()
+	int32 P194 = 0;
+
+	UPROPERTY()
+	int32 P195 = 0;
+
+	UPROPERTY()
+	float P196 = 0.f;
+
+	UPROPERTY()
+	float P197 = 0.f;
+
+	UPROPERTY()
+	int16 P198 = 0;
+
+	UPROPERTY()
+	bool P199 = false;
+
+	UPROPERTY()
+	int32 P200 = 0;
+
+	UPROPERTY()
+	int32 P201 = 0;
+
+	UPROPERTY()
+	int32 P202 = 0;
+
+	UPROPERTY()
+	int32 P203 = 0;
+
+	UPROPERTY()
+	float P204 = 0.f;
+
+	UPROPERTY()
+	float P205 = 0.f;
+
+	UPROPERTY()
+	int16 P206 = 0;
+
+	UPROPERTY()
+	bool P207 = false;
+
+	UPROPERTY()
+	int32 P208 = 0;
+
+	UPROPERTY()
+	int32 P209 = 0;
+
+	UPROPERTY()
+	int32 P210 = 0;
+
+	UPROPERTY()
+	int32 P211 = 0;
+
+	UPROPERTY()
+	float P212 = 0.f;
+
+	UPROPERTY()
+	float P213 = 0.f;
+
+	UPROPERTY()
+	int16 P214 = 0;
+
+	UPROPERTY()
+	bool P215 = false;
+
+	UPROPERTY()
+	int32 P216 = 0;
+
+	UPROPERTY()
+	int32 P217 = 0;
+
+	UPROPERTY()
+	int32 P218 = 0;
+
+	UPROPERTY()
+	int32 P219 = 0;
+
+	UPROPERTY()
+	float P220 = 0.f;
+
+	UPROPERTY()
+	float P221 = 0.f;
+
+	UPROPERTY()
+	int16 P222 = 0;
+
+	UPROPERTY()
+	bool P223 = false;
+
+	UPROPERTY()
+	int32 P224 = 0;
+
+	UPROPERTY()
+	int32 P225 = 0;
+
+	UPROPERTY()
+	int32 P226 = 0;
+
+	UPROPERTY()
+	int32 P227 = 0;
+
+	UPROPERTY()
+	float P228 = 0.f;
+
+	UPROPERTY()
+	float P229 = 0.f;
+
+	UPROPERTY()
+	int16 P230 = 0;
+
+	UPROPERTY()
+	bool P231 = false;
+
+	UPROPERTY()
+	int32 P232 = 0;
+
+	UPROPERTY()
+	int32 P233 = 0;
+
+	UPROPERTY()
+	int32 P234 = 0;
+
+	UPROPERTY()
+	int32 P235 = 0;
+
+	UPROPERTY()
+	float P236 = 0.f;
+
+	UPROPERTY()
+	float P237 = 0.f;
+
+	UPROPERTY()
+	int16 P238 = 0;
+
+	UPROPERTY()
+	bool P239 = false;
+
+	UPROPERTY()
+	int32 P240 = 0;
+
+	UPROPERTY()
+	int32 P241 = 0;
+
+	UPROPERTY()
+	int32 P242 = 0;
+
+	UPROPERTY()
+	int32 P243 = 0;
+
+	UPROPERTY()
+	float P244 = 0.f;
+
+	UPROPERTY()
+	float P245 = 0.f;
+
+	UPROPERTY()
+	int16 P246 = 0;
+
+	UPROPERTY()
+	bool P247 = false;
+
+	UPROPERTY()
+	int32 P248 = 0;
+
+	UPROPERTY()
+	int32 P249 = 0;
+
+	UPROPERTY()
+	int32 P250 = 0;
+
+	UPROPERTY()
+	int32 P251 = 0;
+
+	UPROPERTY()
+	float P252 = 0.f;
+
+	UPROPERTY()
+	float P253 = 0.f;
+
+	UPROPERTY()
+	int16 P254 = 0;
+
+	UPROPERTY()
+	bool P255 = false;
+
+	UPROPERTY()
+	int32 P256 = 0;
+
+	UPROPERTY()
+	int32 P257 = 0;
+
+	UPROPERTY()
+	int32 P258 = 0;
+
+	UPROPERTY()
+	int32 P259 = 0;
+
+	UPROPERTY()
+	float P260 = 0.f;
+
+	UPROPERTY()
+	float P261 = 0.f;
+
+	UPROPERTY()
+	int16 P262 = 0;
+
+	UPROPERTY()
+	bool P263 = false;
+
+	UPROPERTY()
+	int32 P264 = 0;
+
+	UPROPERTY()
+	int32 P265 = 0;
+
+	UPROPERTY()
+	int32 P266 = 0;
+
+	UPROPERTY()
+	int32 P267 = 0;
+
+	UPROPERTY()
+	float P268 = 0.f;
+
+	UPROPERTY()
+	float P269 = 0.f;
+
+	UPROPERTY()
+	int16 P270 = 0;
+
+	UPROPERTY()
+	bool P271 = false;
+
+	UPROPERTY()
+	int32 P272 = 0;
+
+	UPROPERTY()
+	int32 P273 = 0;
+
+	UPROPERTY()
+	int32 P274 = 0;
+
+	UPROPERTY()
+	int32 P275 = 0;
+
+	UPROPERTY()
+	float P276 = 0.f;
+
+	UPROPERTY()
+	float P277 = 0.f;
+
+	UPROPERTY()
+	int16 P278 = 0;
+
+	UPROPERTY()
+	bool P279 = false;
+
+	UPROPERTY()
+	int32 P280 = 0;
+
+	UPROPERTY()
+	int32 P281 = 0;
+
+	UPROPERTY()
+	int32 P282 = 0;
+
+	UPROPERTY()
+	int32 P283 = 0;
+
+	UPROPERTY()
+	float P284 = 0.f;
+
+	UPROPERTY()
+	float P285 = 0.f;
+
+	UPROPERTY()
+	int16 P286 = 0;
+
+	UPROPERTY()
+	bool P287 = false;
+
+	UPROPERTY()
+	int32 P288 = 0;
+
+	UPROPERTY()
+	int32 P289 = 0;
+
+	UPROPERTY()
+	int32 P290 = 0;
+
+	UPROPERTY()
+	int32 P291 = 0;
+
+	UPROPERTY()
+	float P292 = 0.f;
+
+	UPROPERTY()
+	float P293 = 0.f;
+
+	UPROPERTY()
+	int16 P294 = 0;
+
+	UPROPERTY()
+	bool P295 = false;
+
+	UPROPERTY()
+	int32 P296 = 0;
+
+	UPROPERTY()
+	int32 P297 = 0;
+
+	UPROPERTY()
+	int32 P298 = 0;
+
+	UPROPERTY()
+	int32 P299 = 0;
+
+	UPROPERTY()
+	float P300 = 0.f;
+
+	UPROPERTY()
+	float P301 = 0.f;
+
+	UPROPERTY()
+	int16 P302 = 0;
+
+	UPROPERTY()
+	bool P303 = false;
+
+	UPROPERTY()
+	int32 P304 = 0;
+
+	UPROPERTY()
+	int32 P305 = 0;
+
+	UPROPERTY()
+	int32 P306 = 0;
+
+	UPROPERTY()
+	int32 P307 = 0;
+
+	UPROPERTY()
+	float P308 = 0.f;
+
+	UPROPERTY()
+	float P309 = 0.f;
+
+	UPROPERTY()
+	int16 P310 = 0;
+
+	UPROPERTY()
+	bool P311 = false;
+
+	UPROPERTY()
+	int32 P312 = 0;
+
+	UPROPERTY()
+	int32 P313 = 0;
+
+	UPROPERTY()
+	int32 P314 = 0;
+
+	UPROPERTY()
+	int32 P315 = 0;
+
+	UPROPERTY()
+	float P316 = 0.f;
+
+	UPROPERTY()
+	float P317 = 0.f;
+
+	UPROPERTY()
+	int16 P318 = 0;
+
+	UPROPERTY()
+	bool P319 = false;
+
+	UPROPERTY()
+	int32 P320 = 0;
+
+	UPROPERTY()
+	int32 P321 = 0;
+
+	UPROPERTY()
+	int32 P322 = 0;
+
+	UPROPERTY()
+	int32 P323 = 0;
+
+	UPROPERTY()
+	float P324 = 0.f;
+
+	UPROPERTY()
+	float P325 = 0.f;
+
+	UPROPERTY()
+	int16 P326 = 0;
+
+	UPROPERTY()
+	bool P327 = false;
+
+	UPROPERTY()
+	int32 P328 = 0;
+
+	UPROPERTY()
+	int32 P329 = 0;
+
+	UPROPERTY()
+	int32 P330 = 0;
+
+	UPROPERTY()
+	int32 P331 = 0;
+
+	UPROPERTY()
+	float P332 = 0.f;
+
+	UPROPERTY()
+	float P333 = 0.f;
+
+	UPROPERTY()
+	int16 P334 = 0;
+
+	UPROPERTY()
+	bool P335 = false;
+
+	UPROPERTY()
+	int32 P336 = 0;
+
+	UPROPERTY()
+	int32 P337 = 0;
+
+	UPROPERTY()
+	int32 P338 = 0;
+
+	UPROPERTY()
+	int32 P339 = 0;
+
+	UPROPERTY()
+	float P340 = 0.f;
+
+	UPROPERTY()
+	float P341 = 0.f;
+
+	UPROPERTY()
+	int16 P342 = 0;
+
+	UPROPERTY()
+	bool P343 = false;
+
+	UPROPERTY()
+	int32 P344 = 0;
+
+	UPROPERTY()
+	int32 P345 = 0;
+
+	UPROPERTY()
+	int32 P346 = 0;
+
+	UPROPERTY()
+	int32 P347 = 0;
+
+	UPROPERTY()
+	float P348 = 0.f;
+
+	UPROPERTY()
+	float P349 = 0.f;
+
+	UPROPERTY()
+	int16 P350 = 0;
+
+	UPROPERTY()
+	bool P351 = false;
+
+	UPROPERTY()
+	int32 P352 = 0;
+
+	UPROPERTY()
+	int32 P353 = 0;
+
+	UPROPERTY()
+	int32 P354 = 0;
+
+	UPROPERTY()
+	int32 P355 = 0;
+
+	UPROPERTY()
+	float P356 = 0.f;
+
+	UPROPERTY()
+	float P357 = 0.f;
+
+	UPROPERTY()
+	int16 P358 = 0;
+
+	UPROPERTY()
+	bool P359 = false;
+
+	UPROPERTY()
+	int32 P360 = 0;
+
+	UPROPERTY()
+	int32 P361 = 0;
+
+	UPROPERTY()
+	int32 P362 = 0;
+
+	UPROPERTY()
+	int32 P363 = 0;
+
+	UPROPERTY()
+	float P364 = 0.f;
+
+	UPROPERTY()
+	float P365 = 0.f;
+
+	UPROPERTY()
+	int16 P366 = 0;
+
+	UPROPERTY()
+	bool P367 = false;
+
+	UPROPERTY()
+	int32 P368 = 0;
+
+	UPROPERTY()
+	int32 P369 = 0;
+
+	UPROPERTY()
+	int32 P370 = 0;
+
+	UPROPERTY()
+	int32 P371 = 0;
+
+	UPROPERTY()
+	float P372 = 0.f;
+
+	UPROPERTY()
+	float P373 = 0.f;
+
+	UPROPERTY()
+	int16 P374 = 0;
+
+	UPROPERTY()
+	bool P375 = false;
+
+	UPROPERTY()
+	int32 P376 = 0;
+
+	UPROPERTY()
+	int32 P377 = 0;
+
+	UPROPERTY()
+	int32 P378 = 0;
+
+	UPROPERTY()
+	int32 P379 = 0;
+
+	UPROPERTY()
+	float P380 = 0.f;
+
+	UPROPERTY()
+	float P381 = 0.f;
+
+	UPROPERTY()
+	int16 P382 = 0;
+
+	UPROPERTY()
+	bool P383 = false;
+
+	UPROPERTY()
+	int32 P384 = 0;
+
+	UPROPERTY()
+	int32 P385 = 0;
+
+	UPROPERTY()
+	int32 P386 = 0;
+
+	UPROPERTY()
+	int32 P387 = 0;
+
+	UPROPERTY()
+	float P388 = 0.f;
+
+	UPROPERTY()
+	float P389 = 0.f;
+
+	UPROPERTY()
+	int16 P390 = 0;
+
+	UPROPERTY()
+	bool P391 = false;
+
+	UPROPERTY()
+	int32 P392 = 0;
+
+	UPROPERTY()
+	int32 P393 = 0;
+
+	UPROPERTY()
+	int32 P394 = 0;
+
+	UPROPERTY()
+	int32 P395 = 0;
+
+	UPROPERTY()
+	float P396 = 0.f;
+
+	UPROPERTY()
+	float P397 = 0.f;
+
+	UPROPERTY()
+	int16 P398 = 0;
+
+	UPROPERTY()
+	bool P399 = false;
+
+	UPROPERTY()
+	int32 P400 = 0;
+
+	UPROPERTY()
+	int32 P401 = 0;
+
+	UPROPERTY()
+	int32 P402 = 0;
+
+	UPROPERTY()
+	int32 P403 = 0;
+
+	UPROPERTY()
+	float P404 = 0.f;
+
+	UPROPERTY()
+	float P405 = 0.f;
+
+	UPROPERTY()
+	int16 P406 = 0;
+
+	UPROPERTY()
+	bool P407 = false;
+
+	UPROPERTY()
+	int32 P408 = 0;
+
+	UPROPERTY()
+	int32 P409 = 0;
+
+	UPROPERTY()
+	int32 P410 = 0;
+
+	UPROPERTY()
+	int32 P411 = 0;
+
+	UPROPERTY()
+	float P412 = 0.f;
+
+	UPROPERTY()
+	float P413 = 0.f;
+
+	UPROPERTY()
+	int16 P414 = 0;
+
+	UPROPERTY()
+	bool P415 = false;
+
+	UPROPERTY()
+	int32 P416 = 0;
+
+	UPROPERTY()
+	int32 P417 = 0;
+
+	UPROPERTY()
+	int32 P418 = 0;
+
+	UPROPERTY()
+	int32 P419 = 0;
+
+	UPROPERTY()
+	float P420 = 0.f;
+
+	UPROPERTY()
+	float P421 = 0.f;
+
+	UPROPERTY()
+	int16 P422 = 0;
+
+	UPROPERTY()
+	bool P423 = false;
+
+	UPROPERTY()
+	int32 P424 = 0;
+
+	UPROPERTY()
+	int32 P425 = 0;
+
+	UPROPERTY()
+	int32 P426 = 0;
+
+	UPROPERTY()
+	int32 P427 = 0;
+
+	UPROPERTY()
+	float P428 = 0.f;
+
+	UPROPERTY()
+	float P429 = 0.f;
+
+	UPROPERTY()
+	int16 P430 = 0;
+
+	UPROPERTY()
+	bool P431 = false;
+
+	UPROPERTY()
+	int32 P432 = 0;
+
+	UPROPERTY()
+	int32 P433 = 0;
+
+	UPROPERTY()
+	int32 P434 = 0;
+
+	UPROPERTY()
+	int32 P435 = 0;
+
+	UPROPERTY()
+	float P436 = 0.f;
+
+	UPROPERTY()
+	float P437 = 0.f;
+
+	UPROPERTY()
+	int16 P438 = 0;
+
+	UPROPERTY()
+	bool P439 = false;
+
+	UPROPERTY()
+	int32 P440 = 0;
+
+	UPROPERTY()
+	int32 P441 = 0;
+
+	UPROPERTY()
+	int32 P442 = 0;
+
+	UPROPERTY()
+	int32 P443 = 0;
+
+	UPROPERTY()
+	float P444 = 0.f;
+
+	UPROPERTY()
+	float P445 = 0.f;
+
+	UPROPERTY()
+	int16 P446 = 0;
+
+	UPROPERTY()
+	bool P447 = false;
+
+	UPROPERTY()
+	int32 P448 = 0;
+
+	UPROPERTY()
+	int32 P449 = 0;
+
+	UPROPERTY()
+	int32 P450 = 0;
+
+	UPROPERTY()
+	int32 P451 = 0;
+
+	UPROPERTY()
+	float P452 = 0.f;
+
+	UPROPERTY()
+	float P453 = 0.f;
+
+	UPROPERTY()
+	int16 P454 = 0;
+
+	UPROPERTY()
+	bool P455 = false;
+
+	UPROPERTY()
+	int32 P456 = 0;
+
+	UPROPERTY()
+	int32 P457 = 0;
+
+	UPROPERTY()
+	int32 P458 = 0;
+
+	UPROPERTY()
+	int32 P459 = 0;
+
+	UPROPERTY()
+	float P460 = 0.f;
+
+	UPROPERTY()
+	float P461 = 0.f;
+
+	UPROPERTY()
+	int16 P462 = 0;
+
+	UPROPERTY()
+	bool P463 = false;
+
+	UPROPERTY()
+	int32 P464 = 0;
+
+	UPROPERTY()
+	int32 P465 = 0;
+
+	UPROPERTY()
+	int32 P466 = 0;
+
+	UPROPERTY()
+	int32 P467 = 0;
+
+	UPROPERTY()
+	float P468 = 0.f;
+
+	UPROPERTY()
+	float P469 = 0.f;
+
+	UPROPERTY()
+	int16 P470 = 0;
+
+	UPROPERTY()
+	bool P471 = false;
+
+	UPROPERTY()
+	int32 P472 = 0;
+
+	UPROPERTY()
+	int32 P473 = 0;
+
+	UPROPERTY()
+	int32 P474 = 0;
+
+	UPROPERTY()
+	int32 P475 = 0;
+
+	UPROPERTY()
+	float P476 = 0.f;
+
+	UPROPERTY()
+	float P477 = 0.f;
+
+	UPROPERTY()
+	int16 P478 = 0;
+
+	UPROPERTY()
+	bool P479 = false;
+
+	UPROPERTY()
+	int32 P480 = 0;
+
+	UPROPERTY()
+	int32 P481 = 0;
+
+	UPROPERTY()
+	int32 P482 = 0;
+
+	UPROPERTY()
+	int32 P483 = 0;
+
+	UPROPERTY()
+	float P484 = 0.f;
+
+	UPROPERTY()
+	float P485 = 0.f;
+
+	UPROPERTY()
+	int16 P486 = 0;
+
+	UPROPERTY()
+	bool P487 = false;
+
+	UPROPERTY()
+	int32 P488 = 0;
+
+	UPROPERTY()
+	int32 P489 = 0;
+
+	UPROPERTY()
+	int32 P490 = 0;
+
+	UPROPERTY()
+	int32 P491 = 0;
+
+	UPROPERTY()
+	float P492 = 0.f;
+
+	UPROPERTY()
+	float P493 = 0.f;
+
+	UPROPERTY()
+	int16 P494 = 0;
+
+	UPROPERTY()
+	bool P495 = false;
+
+	UPROPERTY()
+	int32 P496 = 0;
+
+	UPROPERTY()
+	int32 P497 = 0;
+
+	UPROPERTY()
+	int32 P498 = 0;
+
+	UPROPERTY()
+	int32 P499 = 0;
+
+	template <typename T, typename FuncType>
+	void ForEachDirect(FuncType&& Func)
+	{
+		if constexpr (std::is_same_v<T, int32>)
+		{
+			Func(P0);
+			Func(P1);
+			Func(P2);
+			Func(P3);
+			Func(P8);
+			Func(P9);
+			Func(P10);
+			Func(P11);
+			Func(P16);
+			Func(P17);
+			Func(P18);
+			Func(P19);
+			Func(P24);
+			Func(P25);
+			Func(P26);
+			Func(P27);
+			Func(P32);
+			Func(P33);
+			Func(P34);
+			Func(P35);
+			Func(P40);
+			Func(P41);
+			Func(P42);
+			Func(P43);
+			Func(P48);
+			Func(P49);
+			Func(P50);
+			Func(P51);
+			Func(P56);
+			Func(P57);
+			Func(P58);
+			Func(P59);
+			Func(P64);
+			Func(P65);
+			Func(P66);
+			Func(P67);
+			Func(P72);
+			Func(P73);
+			Func(P74);
+			Func(P75);
+			Func(P80);
+			Func(P81);
+			Func(P82);
+			Func(P83);
+			Func(P88);
+			Func(P89);
+			Func(P90);
+			Func(P91);
+			Func(P96);
+			Func(P97);
+			Func(P98);
+			Func(P99);
+			Func(P104);
+			Func(P105);
+			Func(P106);
+			Func(P107);
+			Func(P112);
+			Func(P113);
+			Func(P114);
+			Func(P115);
+			Func(P120);
+			Func(P121);
+			Func(P122);
+			Func(P123);
+			Func(P128);
+			Func(P129);
+			Func(P130);
+			Func(P131);
+			Func(P136);
+			Func(P137);
+			Func(P138);
+			Func(P139);
+			Func(P144);
+			Func(P145);
+			Func(P146);
+			Func(P147);
+			Func(P152);
+			Func(P153);
+			Func(P154);
+			Func(P155);
+			Func(P160);
+			Func(P161);
+			Func(P162);
+			Func(P163);
+			Func(P168);
+			Func(P169);
+			Func(P170);
+			Func(P171);
+			Func(P176);
+			Func(P177);
+			Func(P178);
+			Func(P179);
+			Func(P184);
+			Func(P185);
+			Func(P186);
+			Func(P187);
+			Func(P192);
+			Func(P193);
+			Func(P194);
+			Func(P195);
+			Func(P200);
+			Func(P201);
+			Func(P202);
+			Func(P203);
+			Func(P208);
+			Func(P209);
+			Func(P210);
+			Func(P211);
+			Func(P216);
+			Func(P217);
+			Func(P218);
+			Func(P219);
+			Func(P224);
+			Func(P225);
+			Func(P226);
+			Func(P227);
+			Func(P232);
+			Func(P233);
+			Func(P234);
+			Func(P235);
+			Func(P240);
+			Func(P241);
+			Func(P242);
+			Func(P243);
+			Func(P248);
+			Func(P249);
+			Func(P250);
+			Func(P251);
+			Func(P256);
+			Func(P257);
+			Func(P258);
+			Func(P259);
+			Func(P264);
+			Func(P265);
+			Func(P266);
+			Func(P267);
+			Func(P272);
+			Func(P273);
+			Func(P274);
+			Func(P275);
+			Func(P280);
+			Func(P281);
+			Func(P282);
+			Func(P283);
+			Func(P288);
+			Func(P289);
+			Func(P290);
+			Func(P291);
+			Func(P296);
+			Func(P297);
+			Func(P298);
+			Func(P299);
+			Func(P304);
+			Func(P305);
+			Func(P306);
+			Func(P307);
+			Func(P312);
+			Func(P313);
+			Func(P314);
+			Func(P315);
+			Func(P320);
+			Func(P321);
+			Func(P322);
+			Func(P323);
+			Func(P328);
+			Func(P329);
+			Func(P330);
+			Func(P331);
+			Func(P336);
+			Func(P337);
+			Func(P338);
+			Func(P339);
+			Func(P344);
+			Func(P345);
+			Func(P346);
+			Func(P347);
+			Func(P352);
+			Func(P353);
+			Func(P354);
+			Func(P355);
+			Func(P360);
+			Func(P361);
+			Func(P362);
+			Func(P363);
+			Func(P368);
+			Func(P369);
+			Func(P370);
+			Func(P371);
+			Func(P376);
+			Func(P377);
+			Func(P378);
+			Func(P379);
+			Func(P384);
+			Func(P385);
+			Func(P386);
+			Func(P387);
+			Func(P392);
+			Func(P393);
+			Func(P394);
+			Func(P395);
+			Func(P400);
+			Func(P401);
+			Func(P402);
+			Func(P403);
+			Func(P408);
+			Func(P409);
+			Func(P410);
+			Func(P411);
+			Func(P416);
+			Func(P417);
+			Func(P418);
+			Func(P419);
+			Func(P424);
+			Func(P425);
+			Func(P426);
+			Func(P427);
+			Func(P432);
+			Func(P433);
+			Func(P434);
+			Func(P435);
+			Func(P440);
+			Func(P441);
+			Func(P442);
+			Func(P443);
+			Func(P448);
+			Func(P449);
+			Func(P450);
+			Func(P451);
+			Func(P456);
+			Func(P457);
+			Func(P458);
+			Func(P459);
+			Func(P464);
+			Func(P465);
+			Func(P466);
+			Func(P467);
+			Func(P472);
+			Func(P473);
+			Func(P474);
+			Func(P475);
+			Func(P480);
+			Func(P481);
+			Func(P482);
+			Func(P483);
+			Func(P488);
+			Func(P489);
+			Func(P490);
+			Func(P491);
+			Func(P496);
+			Func(P497);
+			Func(P498);
+			Func(P499);
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			Func(P4);
+			Func(P5);
+			Func(P12);
+			Func(P13);
+			Func(P20);
+			Func(P21);
+			Func(P28);
+			Func(P29);
+			Func(P36);
+			Func(P37);
+			Func(P44);
+			Func(P45);
+			Func(P52);
+			Func(P53);
+			Func(P60);
+			Func(P61);
+			Func(P68);
+			Func(P69);
+			Func(P76);
+			Func(P77);
+			Func(P84);
+			Func(P85);
+			Func(P92);
+			Func(P93);
+			Func(P100);
+			Func(P101);
+			Func(P108);
+			Func(P109);
+			Func(P116);
+			Func(P117);
+			Func(P124);
+			Func(P125);
+			Func(P132);
+			Func(P133);
+			Func(P140);
+			Func(P141);
+			Func(P148);
+			Func(P149);
+			Func(P156);
+			Func(P157);
+			Func(P164);
+			Func(P165);
+			Func(P172);
+			Func(P173);
+			Func(P180);
+			Func(P181);
+			Func(P188);
+			Func(P189);
+			Func(P196);
+			Func(P197);
+			Func(P204);
+			Func(P205);
+			Func(P212);
+			Func(P213);
+			Func(P220);
+			Func(P221);
+			Func(P228);
+			Func(P229);
+			Func(P236);
+			Func(P237);
+			Func(P244);
+			Func(P245);
+			Func(P252);
+			Func(P253);
+			Func(P260);
+			Func(P261);
+			Func(P268);
+			Func(P269);
+			Func(P276);
+			Func(P277);
+			Func(P284);
+			Func(P285);
+			Func(P292);
+			Func(P293);
+			Func(P300);
+			Func(P301);
+			Func(P308);
+			Func(P309);
+			Func(P316);
+			Func(P317);
+			Func(P324);
+			Func(P325);
+			Func(P332);
+			Func(P333);
+			Func(P340);
+			Func(P341);
+			Func(P348);
+			Func(P349);
+			Func(P356);
+			Func(P357);
+			Func(P364);
+			Func(P365);
+			Func(P372);
+			Func(P373);
+			Func(P380);
+			Func(P381);
+			Func(P388);
+			Func(P389);
+			Func(P396);
+			Func(P397);
+			Func(P404);
+			Func(P405);
+			Func(P412);
+			Func(P413);
+			Func(P420);
+			Func(P421);
+			Func(P428);
+			Func(P429);
+			Func(P436);
+			Func(P437);
+			Func(P444);
+			Func(P445);
+			Func(P452);
+			Func(P453);
+			Func(P460);
+			Func(P461);
+			Func(P468);
+			Func(P469);
+			Func(P476);
+			Func(P477);
+			Func(P484);
+			Func(P485);
+			Func(P492);
+			Func(P493);
+		}
+		else if constexpr (std::is_same_v<T, int16>)
+		{
+			Func(P6);
+			Func(P14);
+			Func(P22);
+			Func(P30);
+			Func(P38);
+			Func(P46);
+			Func(P54);
+			Func(P62);
+			Func(P70);
+			Func(P78);
+			Func(P86);
+			Func(P94);
+			Func(P102);
+			Func(P110);
+			Func(P118);
+			Func(P126);
+			Func(P134);
+			Func(P142);
+			Func(P150);
+			Func(P158);
+			Func(P166);
+			Func(P174);
+			Func(P182);
+			Func(P190);
+			Func(P198);
+			Func(P206);
+			Func(P214);
+			Func(P222);
+			Func(P230);
+			Func(P238);
+			Func(P246);
+			Func(P254);
+			Func(P262);
+			Func(P270);
+			Func(P278);
+			Func(P286);
+			Func(P294);
+			Func(P302);
+			Func(P310);
+			Func(P318);
+			Func(P326);
+			Func(P334);
+			Func(P342);
+			Func(P350);
+			Func(P358);
+			Func(P366);
+			Func(P374);
+			Func(P382);
+			Func(P390);
+			Func(P398);
+			Func(P406);
+			Func(P414);
+			Func(P422);
+			Func(P430);
+			Func(P438);
+			Func(P446);
+			Func(P454);
+			Func(P462);
+			Func(P470);
+			Func(P478);
+			Func(P486);
+			Func(P494);
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			Func(P7);
+			Func(P15);
+			Func(P23);
+			Func(P31);
+			Func(P39);
+			Func(P47);
+			Func(P55);
+			Func(P63);
+			Func(P71);
+			Func(P79);
+			Func(P87);
+			Func(P95);
+			Func(P103);
+			Func(P111);
+			Func(P119);
+			Func(P127);
+			Func(P135);
+			Func(P143);
+			Func(P151);
+			Func(P159);
+			Func(P167);
+			Func(P175);
+			Func(P183);
+			Func(P191);
+			Func(P199);
+			Func(P207);
+			Func(P215);
+			Func(P223);
+			Func(P231);
+			Func(P239);
+			Func(P247);
+			Func(P255);
+			Func(P263);
+			Func(P271);
+			Func(P279);
+			Func(P287);
+			Func(P295);
+			Func(P303);
+			Func(P311);
+			Func(P319);
+			Func(P327);
+			Func(P335);
+			Func(P343);
+			Func(P351);
+			Func(P359);
+			Func(P367);
+			Func(P375);
+			Func(P383);
+			Func(P391);
+			Func(P399);
+			Func(P407);
+			Func(P415);
+			Func(P423);
+			Func(P431);
+			Func(P439);
+			Func(P447);
+			Func(P455);
+			Func(P463);
+			Func(P471);
+			Func(P479);
+			Func(P487);
+			Func(P495);
+		}
+	}
+};
+
+
+/**
+ * VisitReachable 벤치마크에서 객체 그래프를 만들기 위한 노드
+ */
+UCLASS()
+class UReflectionBenchmarkNode : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<TObjectPtr<UReflectionBenchmarkNode>> Children;
+
+	UPROPERTY()
+	TObjectPtr<UReflectionBenchmarkNode> Parent;
+
+	UPROPERTY()
+	int32 Value = 0;
+};
+
+
+/**
+ * FReflectionHelper의 순회 비용을 TFieldIterator를 직접 쓰는 방식, 멤버에 직접 접근하는 방식과 비교하는 Commandlet
+ * 결과는 로그와 Saved/Benchmarks/ReflectionHelperBenchmark.csv에 기록됩니다.
+ *
+ * 실행 예시)
+ * UnrealEditor-Cmd ReflectionDemo.uproject -run=ReflectionHelperBenchmark -nullrhi -unattended -nopause
+ *
+ * 옵션)
+ * -Quick : 컨테이너 개수를 1000개까지만 측정
+ * -ColdStart : 순회 대신 Layout이 없는 상태에서 모듈 전체를 PrewarmModuleLayouts 하는 시간을 캐시 파일 유무 별로 측정
+ * -Reachability : 순회 대신 이진 트리로 연결된 객체 최대 100만 개에 대해 VisitReachable 하는 시간을 측정 (-Quick이면 10만 개까지)
+ * -Csv=<경로> : CSV 파일 경로 지정
+ */
+UCLASS()
+class UReflectionHelperBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UReflectionHelperBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
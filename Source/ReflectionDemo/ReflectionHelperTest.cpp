@@ -4,6 +4,9 @@
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 #include "ReflectionHelper.h"
+#include "HAL/FileManager.h"
+
+#include <atomic>
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -274,6 +277,1021 @@ bool FReflectionHelperTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("이름이랑 같이 순회 되는지 테스트"), Names[2], TEXT("Int32Member3"));
 		TestEqual(TEXT("이름이랑 같이 순회 되는지 테스트"), Names.Num(), 3);
 	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->FloatMember = 1.f;
+		Target->FloatMember2 = 2.f;
+		Target->FloatMember3 = 3.f;
+
+		const auto Collect = [&]()
+		{
+			TArray<float> Collected;
+			FReflectionHelper::ForEachMember(Target, [&](float Each)
+			{
+				Collected.Add(Each);
+			});
+			return Collected;
+		};
+
+		const TArray<float> Cold = Collect();
+		const TArray<float> Warm = Collect();
+
+		FReflectionHelper::InvalidateLayoutCache();
+		const TArray<float> Invalidated = Collect();
+
+		TestTrue(TEXT("캐시된 Layout으로 순회해도 결과가 같은지 테스트"), Cold == TArray<float>{ 1.f, 2.f, 3.f });
+		TestTrue(TEXT("캐시된 Layout으로 순회해도 결과가 같은지 테스트"), Warm == Cold);
+		TestTrue(TEXT("캐시된 Layout으로 순회해도 결과가 같은지 테스트"), Invalidated == Cold);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+
+		TArray<FName> Names;
+		TArray<FString> Views;
+
+		FReflectionHelper::ForEachMemberWithName(Target, [&](int32& Each, FName Name)
+		{
+			Names.Add(Name);
+		});
+
+		FReflectionHelper::ForEachMemberWithName(Target, [&](int32& Each, FStringView Name)
+		{
+			Views.Emplace(Name);
+		});
+
+		TestEqual(TEXT("FName, FStringView로 이름 받아지는지 테스트"), Names.Num(), 3);
+		TestTrue(TEXT("FName, FStringView로 이름 받아지는지 테스트"), Names[0] == FName{ TEXT("Int32Member") });
+		TestTrue(TEXT("FName, FStringView로 이름 받아지는지 테스트"), Names[2] == FName{ TEXT("Int32Member3") });
+		TestEqual(TEXT("FName, FStringView로 이름 받아지는지 테스트"), Views.Num(), 3);
+		TestEqual(TEXT("FName, FStringView로 이름 받아지는지 테스트"), Views[1], TEXT("Int32Member2"));
+	}
+
+	{
+		TArray<UReflectionHelperTestObject*> Targets;
+		for (int32 i = 0; i < 3; ++i)
+		{
+			UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+			Target->FloatMember = 1.f;
+			Target->FloatMember2 = 2.f;
+			Target->FloatMember3 = 3.f;
+			Targets.Add(Target);
+		}
+		Targets.Add(nullptr);
+
+		int32 Count = 0;
+		float Sum = 0.f;
+
+		FReflectionHelper::ForEachMemberBatch(MakeArrayView(Targets), [&](float Each)
+		{
+			Count++;
+			Sum += Each;
+		});
+
+		TestEqual(TEXT("여러 객체 한 번에 순회 되는지 테스트"), Count, 9);
+		TestEqual(TEXT("여러 객체 한 번에 순회 되는지 테스트"), Sum, 18.f);
+
+		TArray<FReflectionHelperTestStruct> Structs;
+		Structs.SetNum(4);
+
+		FReflectionHelper::ForEachMemberBatch(MakeArrayView(Structs), [Counter = 0](int32& Each) mutable
+		{
+			Each = Counter++;
+		});
+
+		TestEqual(TEXT("여러 구조체 한 번에 순회 되는지 테스트"), Structs[0].Int32Member, 0);
+		TestEqual(TEXT("여러 구조체 한 번에 순회 되는지 테스트"), Structs[3].Int32Member3, 11);
+	}
+
+	{
+		// 클래스가 섞여 있으면 클래스 별로 묶되 묶음 안에서는 원래 순서를 유지
+		TArray<UReflectionHelperTestObject*> Targets;
+		Targets.Add(NewObject<UReflectionHelperTestObject>());
+		Targets.Add(NewObject<UReflectionHelperTestSubObject>());
+		Targets.Add(NewObject<UReflectionHelperTestObject>());
+		Targets.Add(NewObject<UReflectionHelperTestSubObject>());
+
+		FReflectionHelper::ForEachMemberBatch(MakeArrayView(Targets), [Counter = 0](int32& Each) mutable
+		{
+			Each = Counter++;
+		});
+
+		TestEqual(TEXT("여러 클래스 섞어서 한 번에 순회 되는지 테스트"), Targets[0]->Int32Member, 0);
+		TestEqual(TEXT("여러 클래스 섞어서 한 번에 순회 되는지 테스트"), Targets[2]->Int32Member, 3);
+		TestEqual(TEXT("여러 클래스 섞어서 한 번에 순회 되는지 테스트"), Targets[1]->Int32Member, 6);
+		TestEqual(TEXT("여러 클래스 섞어서 한 번에 순회 되는지 테스트"), Targets[3]->Int32Member3, 11);
+	}
+
+	{
+		TArray<UReflectionHelperTestObject*> Targets;
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+			Target->Int32Member = 1;
+			Target->Int32Member2 = 2;
+			Target->Int32Member3 = 3;
+			Targets.Add(Target);
+		}
+
+		std::atomic<int32> Sum = 0;
+
+		FReflectionHelper::ParallelForEachMember(MakeArrayView(Targets), [&](const int32& Each)
+		{
+			Sum += Each;
+		});
+
+		TestEqual(TEXT("병렬로 순회 되는지 테스트"), Sum.load(), 6000);
+
+		// non-const 레퍼런스로 받으려면 Mutable 명시해야 함
+		//FReflectionHelper::ParallelForEachMember(MakeArrayView(Targets), [&](int32& Each) { });
+		FReflectionHelper::ParallelForEachMember<EReflectionParallelAccess::Mutable>(MakeArrayView(Targets), [](int32& Each)
+		{
+			Each *= 10;
+		});
+
+		TestEqual(TEXT("병렬로 순회 되는지 테스트"), Targets[999]->Int32Member3, 30);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Int32Member = 1;
+		Target->Int32Member2 = 2;
+		Target->Int32Member3 = 3;
+		Target->FloatMember = 10.f;
+		Target->FloatMember2 = 20.f;
+		Target->FloatMember3 = 30.f;
+
+		TArray<int32> Ints;
+		TArray<float> Floats;
+		int32 StructCount = 0;
+
+		FReflectionHelper::ForEachMemberOf(Target,
+			[&](int32 Each) { Ints.Add(Each); },
+			[&](float& Each) { Floats.Add(Each); Each = 0.f; },
+			[&](const FReflectionHelperTestStruct& Each) { StructCount++; });
+
+		TestEqual(TEXT("여러 타입 한 번에 순회 되는지 테스트"), Ints.Num(), 3);
+		TestEqual(TEXT("여러 타입 한 번에 순회 되는지 테스트"), Ints[2], 3);
+		TestEqual(TEXT("여러 타입 한 번에 순회 되는지 테스트"), Floats.Num(), 3);
+		TestEqual(TEXT("여러 타입 한 번에 순회 되는지 테스트"), Floats[1], 20.f);
+		TestEqual(TEXT("여러 타입 한 번에 순회 되는지 테스트"), Target->FloatMember2, 0.f);
+		TestEqual(TEXT("여러 타입 한 번에 순회 되는지 테스트"), StructCount, 3);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Int32Member2 = 7;
+
+		int32 Value = 0;
+
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::FindMember<int32>(Target, TEXT("Int32Member2")) == &Target->Int32Member2);
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::FindMember<float>(Target, TEXT("Int32Member2")) == nullptr);
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::FindMember<int32>(Target, TEXT("NoSuchMember")) == nullptr);
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::TryGetMember(Target, TEXT("Int32Member2"), Value));
+		TestEqual(TEXT("이름으로 멤버 찾기 테스트"), Value, 7);
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::SetMember(Target, TEXT("Int32Member3"), 9));
+		TestEqual(TEXT("이름으로 멤버 찾기 테스트"), Target->Int32Member3, 9);
+		TestFalse(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::SetMember(Target, TEXT("Int32Member3"), 9.f));
+
+		// 컨테이너 멤버는 원소 타입까지 일치해야 함
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::FindMember<TArray<int32>>(Target, TEXT("Int32Array")) == &Target->Int32Array);
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), FReflectionHelper::FindMember<TArray<float>>(Target, TEXT("Int32Array")) == nullptr);
+
+		const FReflectionHelperTestStruct ConstTarget{};
+
+		// const 구조체에서는 const 포인터가 나와야 함
+		const int16* ConstMember = FReflectionHelper::FindMember<int16>(ConstTarget, TEXT("Int16Member"));
+		TestTrue(TEXT("이름으로 멤버 찾기 테스트"), ConstMember == &ConstTarget.Int16Member);
+	}
+
+	{
+		TArray<UReflectionHelperTestObject*> Targets;
+		for (int32 i = 0; i < 5; ++i)
+		{
+			UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+			Target->FloatMember = static_cast<float>(i);
+			Target->FloatMember2 = i * 10.f;
+			Target->FloatMember3 = -i * 10.f;
+			Targets.Add(Target);
+		}
+
+		TReflectionMemberColumns<float> Columns;
+
+		TestTrue(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), FReflectionHelper::GatherMembers(MakeArrayView(Targets), Columns));
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), Columns.NumContainers, 5);
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), Columns.NumMembers, 3);
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), Columns.GetColumn(1)[4], 40.f);
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), FReflectionColumnKernels::Sum(Columns.GetColumn(0)), 10.f);
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), FReflectionColumnKernels::Min(Columns.GetColumn(2)), -40.f);
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), FReflectionColumnKernels::Max(Columns.GetColumn(1)), 40.f);
+
+		FReflectionColumnKernels::Clamp(Columns.Values, -15.f, 15.f);
+
+		TestTrue(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), FReflectionHelper::ScatterMembers(MakeArrayView(Targets), Columns));
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), Targets[4]->FloatMember, 4.f);
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), Targets[4]->FloatMember2, 15.f);
+		TestEqual(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), Targets[4]->FloatMember3, -15.f);
+
+		Targets.Add(nullptr);
+		TestFalse(TEXT("멤버 모아서 처리하고 되돌려 쓰기 테스트"), FReflectionHelper::GatherMembers(MakeArrayView(Targets), Columns));
+
+		const TArray<int32> Ints{ 5, -3, 8, 1, 9, -7, 2 };
+		TestEqual(TEXT("벡터화 된 연산 테스트"), FReflectionColumnKernels::Sum(Ints), int64{ 15 });
+		TestEqual(TEXT("벡터화 된 연산 테스트"), FReflectionColumnKernels::Min(Ints), -7);
+		TestEqual(TEXT("벡터화 된 연산 테스트"), FReflectionColumnKernels::Max(Ints), 9);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->StructArray.SetNum(2);
+		Target->Object = NewObject<UReflectionHelperTestObject>(Target);
+		Target->Object2 = NewObject<UReflectionHelperTestObject>();
+		Target->Object3 = Target;
+
+		const auto CountDeep = [&](const FReflectionDeepIterationOptions& Options)
+		{
+			int32 Count = 0;
+			FReflectionHelper::ForEachMemberDeep(Target, [&](int32 Each)
+			{
+				Count++;
+			}, Options);
+			return Count;
+		};
+
+		// 직속 3 + 구조체 3 * 3 + TArray<구조체> 2 * 3 + 소유한 객체 (3 + 3 * 3), 소유하지 않은 Object2와 자기 자신인 Object3은 제외
+		TestEqual(TEXT("중첩된 멤버까지 순회 되는지 테스트"), CountDeep({}), 30);
+		TestEqual(TEXT("중첩된 멤버까지 순회 되는지 테스트"), CountDeep({ .bFollowObjects = false }), 18);
+		TestEqual(TEXT("중첩된 멤버까지 순회 되는지 테스트"), CountDeep({ .MaxDepth = 0 }), 3);
+		TestEqual(TEXT("중첩된 멤버까지 순회 되는지 테스트"), CountDeep({ .bOnlyOwnedObjects = false }), 42);
+
+		// 구조체 루트는 RootOwner를 소유자로 봄. 가리키는 객체마다 직속 3 + 구조체 3 * 3
+		FReflectionHelperTestExtendedTypesStruct Struct;
+		Struct.ObjectPtr = NewObject<UReflectionHelperTestObject>(Target);
+		Struct.RawObject = NewObject<UReflectionHelperTestObject>();
+		Struct.ObjectPtrArray = { Target };
+
+		const auto CountStructDeep = [&](const FReflectionDeepIterationOptions& Options)
+		{
+			int32 Count = 0;
+			FReflectionHelper::ForEachMemberDeep(Struct, [&](int32 Each)
+			{
+				Count++;
+			}, Options);
+			return Count;
+		};
+
+		// 소유자가 없으면 bOnlyOwnedObjects와 관계없이 Target까지 모두 따라감
+		TestEqual(TEXT("구조체 루트의 소유자 테스트"), CountStructDeep({}), 12 + 12 + 30);
+		TestEqual(TEXT("구조체 루트의 소유자 테스트"), CountStructDeep({ .RootOwner = Target }), 12);
+		TestEqual(TEXT("구조체 루트의 소유자 테스트"), CountStructDeep({ .bOnlyOwnedObjects = false, .RootOwner = Target }), 24);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Int32Array = { 1, 2 };
+		Target->Int32Array2 = { 3 };
+		Target->Int32Map = { { 0, 10 }, { 1, 20 }, { 2, 30 }, { 3, 40 } };
+		Target->Int32Map.Remove(1);
+		Target->Int32Set = { 100, 200 };
+
+		int32 Count = 0;
+		int32 Sum = 0;
+
+		FReflectionHelper::ForEachElement(Target, [&](const int32& Each)
+		{
+			Count++;
+			Sum += Each;
+		});
+
+		TestEqual(TEXT("TArray, TSet, TMap 원소 순회 테스트"), Count, 8);
+		TestEqual(TEXT("TArray, TSet, TMap 원소 순회 테스트"), Sum, 1 + 2 + 3 + 10 + 30 + 40 + 100 + 200);
+
+		// 수정하는 순회는 TSet을 건너뜀
+		FReflectionHelper::ForEachMutableElement(Target, [](int32& Each)
+		{
+			Each *= 2;
+		});
+
+		TestEqual(TEXT("TArray, TSet, TMap 원소 순회 테스트"), Target->Int32Array[1], 4);
+		TestEqual(TEXT("TArray, TSet, TMap 원소 순회 테스트"), Target->Int32Map[3], 80);
+		TestTrue(TEXT("TArray, TSet, TMap 원소 순회 테스트"), Target->Int32Set.Contains(100));
+	}
+
+	{
+		// 구멍이 많은 TSet / TMap에서도 FScriptSetHelper / FScriptMapHelper와 같은 유효 인덱스를 순서대로 방문해야 함
+		TSet<int32> Set;
+		TMap<int32, int32> Map;
+		for (int32 i = 0; i < 200; ++i)
+		{
+			Set.Add(i);
+			Map.Add(i, i);
+		}
+		for (int32 i = 0; i < 200; ++i)
+		{
+			if (i % 37 != 5)
+			{
+				Set.Remove(i);
+				Map.Remove(i);
+			}
+		}
+
+		const FSetProperty* SetProperty = FindFProperty<FSetProperty>(UReflectionHelperTestObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Int32Set));
+		FScriptSetHelper SetHelper{ SetProperty, &Set };
+
+		TArray<int32> Expected;
+		for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+		{
+			if (SetHelper.IsValidIndex(Index))
+			{
+				Expected.Add(Index);
+			}
+		}
+
+		TArray<int32> SetIndices;
+		Details::ForEachValidIndex(&Set, [&](int32 Index) { SetIndices.Add(Index); });
+
+		TArray<int32> MapIndices;
+		Details::ForEachValidIndex(&Map, [&](int32 Index) { MapIndices.Add(Index); });
+
+		TestEqual(TEXT("유효 인덱스 순회 테스트"), Expected.Num(), 6);
+		TestTrue(TEXT("유효 인덱스 순회 테스트"), SetIndices == Expected);
+		TestTrue(TEXT("유효 인덱스 순회 테스트"), MapIndices == Expected);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Int32Member2 = 42;
+		Target->Struct2.FloatMember = 1.5f;
+		Target->StructArray.SetNum(3);
+		Target->StructArray[2].Int16Member = 7;
+		Target->Int32Map = { { 1, 10 }, { 2, 20 } };
+		Target->Int32Set = { 100 };
+		Target->StringMember = TEXT("Snapshot");
+		Target->Object = Target;
+
+		TArray<uint8> Buffer;
+		int64 NumBytes = 0;
+
+		// 빈 버퍼로 필요한 크기를 알아낸 뒤 다시 기록
+		TestFalse(TEXT("스냅샷 저장 / 복원 테스트"), FReflectionHelper::SaveSnapshot(Target, Buffer, NumBytes));
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), NumBytes > 0);
+
+		Buffer.SetNumUninitialized(NumBytes);
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), FReflectionHelper::SaveSnapshot(Target, Buffer, NumBytes));
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), NumBytes, static_cast<int64>(Buffer.Num()));
+
+		Target->Int32Member2 = 0;
+		Target->Struct2.FloatMember = 0.f;
+		Target->StructArray.Empty();
+		Target->Int32Map.Add(3, 30);
+		Target->Int32Set.Empty();
+		Target->StringMember.Empty();
+		Target->Object = nullptr;
+
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), FReflectionHelper::LoadSnapshot(Target, Buffer));
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), Target->Int32Member2, 42);
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), Target->Struct2.FloatMember, 1.5f);
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), Target->StructArray.Num(), 3);
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), Target->StructArray[2].Int16Member, static_cast<int16>(7));
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), Target->Int32Map.Num(), 2);
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), Target->Int32Map[2], 20);
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), Target->Int32Set.Contains(100));
+		TestEqual(TEXT("스냅샷 저장 / 복원 테스트"), Target->StringMember, FString{ TEXT("Snapshot") });
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), Target->Object == Target);
+
+		// 다른 타입의 스냅샷은 거부
+		FReflectionHelperTestStruct Other;
+		TestFalse(TEXT("스냅샷 저장 / 복원 테스트"), FReflectionHelper::LoadSnapshot(Other, Buffer));
+	}
+
+	{
+		// 저장과 복원 사이에 참조하던 객체가 파괴되면 nullptr로 복원
+		UReflectionHelperTestObject* Referenced = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Object = Referenced;
+
+		TArray<uint8> Buffer;
+		int64 NumBytes = 0;
+		FReflectionHelper::SaveSnapshot(Target, Buffer, NumBytes);
+		Buffer.SetNumUninitialized(NumBytes);
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), FReflectionHelper::SaveSnapshot(Target, Buffer, NumBytes));
+
+		Referenced->MarkAsGarbage();
+
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), FReflectionHelper::LoadSnapshot(Target, Buffer));
+		TestTrue(TEXT("스냅샷 저장 / 복원 테스트"), Target->Object == nullptr);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		const UReflectionHelperTestObject* Default = GetDefault<UReflectionHelperTestObject>();
+
+		const auto IndexOf = [](FName Name)
+		{
+			int32 Index = 0;
+			for (TFieldIterator<FProperty> It{ UReflectionHelperTestObject::StaticClass() }; It; ++It, ++Index)
+			{
+				if (It->GetFName() == Name)
+				{
+					return Index;
+				}
+			}
+			return INDEX_NONE;
+		};
+
+		TestEqual(TEXT("멤버 Diff 테스트"), FReflectionHelper::Diff(Target, Default).CountSetBits(), 0);
+
+		Target->Int32Member2 = 7;
+		Target->FloatMember3 = 2.f;
+		Target->StringMember = TEXT("Dirty");
+
+		const TBitArray<> Dirty = FReflectionHelper::Diff(Target, Default);
+		TestEqual(TEXT("멤버 Diff 테스트"), Dirty.CountSetBits(), 3);
+		TestTrue(TEXT("멤버 Diff 테스트"), Dirty[IndexOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Int32Member2))]);
+		TestTrue(TEXT("멤버 Diff 테스트"), Dirty[IndexOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, FloatMember3))]);
+		TestTrue(TEXT("멤버 Diff 테스트"), Dirty[IndexOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, StringMember))]);
+
+		const TBitArray<> DirtyFloats = FReflectionHelper::Diff<float>(Target, Default);
+		TestEqual(TEXT("멤버 Diff 테스트"), DirtyFloats.CountSetBits(), 1);
+		TestTrue(TEXT("멤버 Diff 테스트"), DirtyFloats[IndexOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, FloatMember3))]);
+
+		FReflectionHelperTestStruct Struct;
+		TestEqual(TEXT("멤버 Diff 테스트"), FReflectionHelper::Diff(Target, Struct).Num(), 0);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* Target2 = NewObject<UReflectionHelperTestObject>();
+
+		const auto Fill = [](UReflectionHelperTestObject* Each, const TArray<int32>& SetElements)
+		{
+			Each->Int32Member = 3;
+			Each->FloatArray = { 1.f, 2.f };
+			Each->StructArray.SetNum(1);
+			Each->StringMember = TEXT("Hash");
+			for (const int32 Element : SetElements)
+			{
+				Each->Int32Set.Add(Element);
+			}
+		};
+
+		// TSet은 원소를 넣은 순서와 무관해야 함
+		Fill(Target, { 1, 2, 3 });
+		Fill(Target2, { 3, 2, 1 });
+
+		TestEqual(TEXT("멤버 해시 테스트"), FReflectionHelper::HashMembers(Target), FReflectionHelper::HashMembers(Target2));
+
+		Target2->StringMember = TEXT("Hash2");
+		TestNotEqual(TEXT("멤버 해시 테스트"), FReflectionHelper::HashMembers(Target), FReflectionHelper::HashMembers(Target2));
+
+		// float 멤버만 해시하면 FString 차이는 무시됨
+		TestEqual(TEXT("멤버 해시 테스트"), FReflectionHelper::HashMembers<float>(Target), FReflectionHelper::HashMembers<float>(Target2));
+
+		Target2->FloatMember2 = 1.f;
+		TestNotEqual(TEXT("멤버 해시 테스트"), FReflectionHelper::HashMembers<float>(Target), FReflectionHelper::HashMembers<float>(Target2));
+	}
+
+	{
+		// 주소가 달라도 경로가 같은 객체를 가리키면 해시가 같아야 함 (UObject* 멤버는 경로로 해시)
+		const FName Name = MakeUniqueObjectName(GetTransientPackage(), UReflectionHelperTestObject::StaticClass(), TEXT("HashReference"));
+
+		UReflectionHelperTestObject* First = NewObject<UReflectionHelperTestObject>(GetTransientPackage(), Name);
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Object = First;
+		const uint64 FirstHash = FReflectionHelper::HashMembers(Target);
+
+		// 같은 경로를 비워준 뒤 새 객체를 그 경로에 만듦
+		First->Rename(nullptr, nullptr, REN_DontCreateRedirectors | REN_NonTransactional);
+		UReflectionHelperTestObject* Second = NewObject<UReflectionHelperTestObject>(GetTransientPackage(), Name);
+
+		UReflectionHelperTestObject* Target2 = NewObject<UReflectionHelperTestObject>();
+		Target2->Object = Second;
+
+		TestTrue(TEXT("멤버 해시 테스트"), First != Second);
+		TestEqual(TEXT("멤버 해시 테스트"), FReflectionHelper::HashMembers(Target2), FirstHash);
+
+		Target2->Object = First;
+		TestNotEqual(TEXT("멤버 해시 테스트"), FReflectionHelper::HashMembers(Target2), FirstHash);
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* Target2 = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* Loaded = NewObject<UReflectionHelperTestObject>();
+
+		const auto AcceptAll = [](const FSoftObjectPath&)
+		{
+			return true;
+		};
+
+		bool bLoaded = false;
+		UReflectionHelperTestObject* Containers[] = { Target, Target2 };
+
+		// 가리키는 애셋이 없으면 바로 완료
+		TestFalse(TEXT("Soft 멤버 비동기 로드 테스트"), FReflectionHelper::AsyncLoadSoftMembers(MakeArrayView(Containers), AcceptAll, [&]() { bLoaded = true; }).IsValid());
+		TestTrue(TEXT("Soft 멤버 비동기 로드 테스트"), bLoaded);
+
+		Target->SoftObjectPtr = Loaded;
+		Target->SoftObjectPtr2 = Loaded;
+		Target2->SoftObjectPtr3 = Loaded;
+		Target2->SoftClassPtr = UReflectionHelperTestObject::StaticClass();
+
+		// 같은 경로는 한 번만 요청
+		const TSharedPtr<FStreamableHandle> Handle = FReflectionHelper::AsyncLoadSoftMembers(MakeArrayView(Containers), AcceptAll, []() {});
+		TestTrue(TEXT("Soft 멤버 비동기 로드 테스트"), Handle.IsValid());
+
+		TArray<FSoftObjectPath> Requested;
+		Handle->GetRequestedAssets(Requested);
+		TestEqual(TEXT("Soft 멤버 비동기 로드 테스트"), Requested.Num(), 2);
+
+		// Filter로 걸러낸 경로는 요청하지 않음
+		const TSharedPtr<FStreamableHandle> FilteredHandle = FReflectionHelper::AsyncLoadSoftMembers(MakeArrayView(Containers), [&](const FSoftObjectPath& Path)
+		{
+			return Path != FSoftObjectPath{ Loaded };
+		}, []() {});
+
+		Requested.Reset();
+		FilteredHandle->GetRequestedAssets(Requested);
+		TestEqual(TEXT("Soft 멤버 비동기 로드 테스트"), Requested.Num(), 1);
+	}
+
+	{
+		FReflectionHelperTestStruct Struct{};
+		Struct.Int32Member = 3;
+		Struct.FloatMember2 = 1.5f;
+		Struct.BoolMember3 = true;
+
+		FString Json;
+		FReflectionHelper::WriteJson(Struct, Json);
+
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.StartsWith(TEXT("{\"Int16Member\":0,")));
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.Contains(TEXT("\"Int32Member\":3,")));
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.Contains(TEXT("\"FloatMember2\":1.5,")));
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.EndsWith(TEXT("\"BoolMember3\":true}")));
+
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->StructArray.SetNum(2);
+		Target->Int32Map = { { 1, 10 } };
+		Target->StringMember = TEXT("Json");
+
+		// 같은 FString을 재사용
+		FReflectionHelper::WriteJson(Target, Json);
+
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.Contains(TEXT("\"Int32Map\":{\"1\":10}")));
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.Contains(TEXT("\"StringMember\":\"Json\"")));
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.Contains(TEXT("\"Object\":null")));
+		TestTrue(TEXT("JSON 내보내기 테스트"), Json.Contains(TEXT("\"StructArray\":[{\"Int16Member\":0,")));
+	}
+
+	{
+		FReflectionHelperTestExtendedTypesStruct Target;
+		Target.NameMember = TEXT("Name_2");
+		Target.TextMember = FText::FromString(TEXT("Text"));
+		Target.NameSet = { TEXT("A"), TEXT("B_0") };
+
+		// FName은 번호까지 포함해 문자열로 쓰고 FText는 표시 문자열을 씀
+		FString Json;
+		FReflectionHelper::WriteJson(Target, Json);
+
+		TestTrue(TEXT("JSON FName, FText 내보내기 테스트"), Json.Contains(TEXT("\"NameMember\":\"Name_2\"")));
+		TestTrue(TEXT("JSON FName, FText 내보내기 테스트"), Json.Contains(TEXT("\"TextMember\":\"Text\"")));
+		TestTrue(TEXT("JSON FName, FText 내보내기 테스트"), Json.Contains(TEXT("\"NameSet\":[\"A\",\"B_0\"]")));
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Int32Array = { 9, 9, 9, 9 };
+
+		const FString Json = TEXT(R"({
+			"int32member": 5,
+			"FloatMember2": 2.5,
+			"BoolMember3": true,
+			"Unknown": { "Nested": [1, 2, { "Deep": null }] },
+			"Struct": { "Int16Member": 7 },
+			"StructArray": [ { "Int32Member": 1 }, { "Int32Member": 2 } ],
+			"Int32Array": [ 1, 2, 3 ],
+			"Int32Map": { "4": 40, "5": 50 },
+			"Int32Set": [ 1, 1, 2 ],
+			"StringMember": "Imported"
+		})");
+
+		TestTrue(TEXT("JSON 가져오기 테스트"), FReflectionHelper::ReadJson(Target, Json));
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Int32Member, 5);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->FloatMember2, 2.5f);
+		TestTrue(TEXT("JSON 가져오기 테스트"), Target->BoolMember3);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Struct.Int16Member, static_cast<int16>(7));
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->StructArray.Num(), 2);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->StructArray[1].Int32Member, 2);
+		TestTrue(TEXT("JSON 가져오기 테스트"), Target->Int32Array == TArray<int32>{ 1, 2, 3 });
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Int32Map[5], 50);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Int32Set.Num(), 2);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->StringMember, FString{ TEXT("Imported") });
+
+		// 타입이 맞지 않는 값은 건너뛰고 나머지는 읽음
+		TestFalse(TEXT("JSON 가져오기 테스트"), FReflectionHelper::ReadJson(Target, TEXT(R"({ "Int32Member": "Text", "Int32Member2": 8 })")));
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Int32Member, 5);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Int32Member2, 8);
+
+		// 타입이 맞지 않거나 범위를 벗어나는 원소는 배열에 남지 않음
+		TestFalse(TEXT("JSON 가져오기 테스트"), FReflectionHelper::ReadJson(Target, TEXT(R"({
+			"Int32Array": [ 1, true, 3, 1e20 ],
+			"StructArray": [ { "Int32Member": 1 }, 5, { "Int32Member": 2 } ],
+			"Int32Member2": 1e10
+		})")));
+		TestTrue(TEXT("JSON 가져오기 테스트"), Target->Int32Array == TArray<int32>{ 1, 3 });
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->StructArray.Num(), 2);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->StructArray[1].Int32Member, 2);
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Int32Member2, 8);
+
+		// 타입이 맞지 않는 TSet 원소와 TMap 값도 기본값으로 남지 않음
+		TestFalse(TEXT("JSON 가져오기 테스트"), FReflectionHelper::ReadJson(Target, TEXT(R"({
+			"Int32Set": [ 1, "Text", 2 ],
+			"Int32Map": { "1": 10, "2": "Text", "3": 30 }
+		})")));
+		TestTrue(TEXT("JSON 가져오기 테스트"), Target->Int32Set.Num() == 2 && Target->Int32Set.Contains(1) && Target->Int32Set.Contains(2));
+		TestTrue(TEXT("JSON 가져오기 테스트"), Target->Int32Map.Num() == 2 && !Target->Int32Map.Contains(2));
+		TestEqual(TEXT("JSON 가져오기 테스트"), Target->Int32Map[3], 30);
+
+		// WriteJson으로 쓴 것을 다시 읽을 수 있어야 함
+		FString Written;
+		FReflectionHelper::WriteJson(Target, Written);
+
+		UReflectionHelperTestObject* Copy = NewObject<UReflectionHelperTestObject>();
+		TestTrue(TEXT("JSON 가져오기 테스트"), FReflectionHelper::ReadJson(Copy, Written));
+		TestEqual(TEXT("JSON 가져오기 테스트"), FReflectionHelper::Diff(Target, Copy).CountSetBits(), 0);
+	}
+
+	{
+		using namespace Details;
+
+		// 구조체와 UObject가 들어가지 않는 타입의 시그니처는 컴파일 타임에 계산됨
+		static_assert(TTypeSignature<TArray<TMap<int32, FString>>>::Get() != TTypeSignature<TArray<TMap<int32, float>>>::Get());
+		static_assert(TTypeSignature<TArray<int32>>::Get() != TTypeSignature<TArray<TArray<int32>>>::Get());
+
+		const UClass* Class = UReflectionHelperTestObject::StaticClass();
+		const auto SignatureOf = [&](FName Name)
+		{
+			return GetTypeSignature(FindFProperty<FProperty>(Class, Name));
+		};
+
+		TestTrue(TEXT("타입 시그니처 테스트"), SignatureOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Map2)) == TTypeSignature<TMap<int32, float>>::Get());
+		TestTrue(TEXT("타입 시그니처 테스트"), SignatureOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, StructArray)) == TTypeSignature<TArray<FReflectionHelperTestStruct>>::Get());
+		TestTrue(TEXT("타입 시그니처 테스트"), SignatureOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Object)) == TTypeSignature<UReflectionHelperTestObject*>::Get());
+		TestTrue(TEXT("타입 시그니처 테스트"), SignatureOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, SoftClassPtr)) == TTypeSignature<TSoftClassPtr<UReflectionHelperTestObject>>::Get());
+		TestTrue(TEXT("타입 시그니처 테스트"), SignatureOf(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Map)) != TTypeSignature<TMap<int32, float>>::Get());
+
+		// 캐시된 값과 새로 계산한 값이 같아야 함
+		const FProperty* Property = FindFProperty<FProperty>(Class, GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, StructArray));
+		TestTrue(TEXT("타입 시그니처 테스트"), GetTypeSignature(Property) == ComputeTypeSignature(Property));
+	}
+
+	{
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Int32Array.Reserve(100);
+		Target->Int32Array = { 1, 2, 3 };
+		Target->Object = NewObject<UReflectionHelperTestObject>(Target);
+		Target->Object->FloatArray.Reserve(10);
+		Target->Object2 = NewObject<UReflectionHelperTestObject>();
+
+		const FReflectionMemoryReport Report = FReflectionHelper::MeasureMemory(Target);
+
+		const auto FindMember = [&](FName Name)
+		{
+			return Report.Members.FindByPredicate([&](const FReflectionMemoryReport::FMember& Each) { return Each.Name == Name; });
+		};
+
+		const FReflectionMemoryReport::FMember* Int32Array = FindMember(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Int32Array));
+		TestTrue(TEXT("메모리 측정 테스트"), Int32Array->Usage.AllocatedBytes >= 100 * static_cast<int64>(sizeof(int32)));
+		TestEqual(TEXT("메모리 측정 테스트"), Int32Array->Usage.UsedBytes, 3 * static_cast<int64>(sizeof(int32)));
+
+		// 소유한 객체는 따라가고 소유하지 않은 객체는 따라가지 않음
+		const int64 ObjectSize = UReflectionHelperTestObject::StaticClass()->GetStructureSize();
+		const FReflectionMemoryReport::FMember* Object = FindMember(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Object));
+		TestTrue(TEXT("메모리 측정 테스트"), Object->Usage.AllocatedBytes >= ObjectSize + 10 * static_cast<int64>(sizeof(float)));
+		TestEqual(TEXT("메모리 측정 테스트"), FindMember(GET_MEMBER_NAME_CHECKED(UReflectionHelperTestObject, Object2))->Usage.AllocatedBytes, static_cast<int64>(0));
+		TestEqual(TEXT("메모리 측정 테스트"), Report.Classes.FindChecked(UReflectionHelperTestObject::StaticClass()).NumObjects, 2);
+
+		const FReflectionMemoryReport Shallow = FReflectionHelper::MeasureMemory(Target, { .bFollowObjects = false });
+		TestEqual(TEXT("메모리 측정 테스트"), Shallow.Classes.FindChecked(UReflectionHelperTestObject::StaticClass()).NumObjects, 1);
+	}
+
+	{
+		TArray<UReflectionHelperTestObject*> Targets;
+		for (int32 Index = 0; Index < 64; ++Index)
+		{
+			UReflectionHelperTestObject* Each = Targets.Add_GetRef(NewObject<UReflectionHelperTestObject>());
+			Each->Int32Array.Reserve(1000);
+			Each->Int32Array = { 1, 2, 3 };
+			Each->StringMember.Reserve(100);
+			Each->StringMember = TEXT("Shrink");
+			Each->Int32Set = { 1, 2, 3, 4 };
+			Each->Int32Set.Remove(2);
+			Each->Int32Map = { { 1, 10 }, { 2, 20 } };
+			Each->Int32Map.Remove(1);
+		}
+
+		const int64 SlackBefore = FReflectionHelper::MeasureMemory(Targets[0]).GetTotal().GetSlackBytes();
+		const int64 Reclaimed = FReflectionHelper::ShrinkMembers(MakeArrayView(Targets));
+
+		TestTrue(TEXT("멤버 Shrink 테스트"), Reclaimed >= 64 * 997 * static_cast<int64>(sizeof(int32)));
+		TestTrue(TEXT("멤버 Shrink 테스트"), FReflectionHelper::MeasureMemory(Targets[0]).GetTotal().GetSlackBytes() < SlackBefore);
+
+		// 내용은 그대로 유지
+		TestTrue(TEXT("멤버 Shrink 테스트"), Targets[0]->Int32Array == TArray<int32>{ 1, 2, 3 });
+		TestEqual(TEXT("멤버 Shrink 테스트"), Targets[0]->StringMember, FString{ TEXT("Shrink") });
+		TestEqual(TEXT("멤버 Shrink 테스트"), Targets[0]->Int32Set.Num(), 3);
+		TestTrue(TEXT("멤버 Shrink 테스트"), Targets[0]->Int32Set.Contains(4) && !Targets[0]->Int32Set.Contains(2));
+		TestEqual(TEXT("멤버 Shrink 테스트"), Targets[0]->Int32Map[2], 20);
+	}
+
+	{
+		TArray<UReflectionHelperTestObject*> Targets;
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			Targets.Add(NewObject<UReflectionHelperTestObject>());
+		}
+
+		int32 Count = 0;
+		auto Visitor = FReflectionHelper::MakeSlicedVisitor(MakeArrayView(Targets), [&](int32& Each)
+		{
+			Count++;
+		});
+
+		// 시간이 없어도 조금씩은 진행됨
+		TestFalse(TEXT("나누어 순회 테스트"), Visitor.Tick(0.));
+		TestTrue(TEXT("나누어 순회 테스트"), Count > 0);
+		TestTrue(TEXT("나누어 순회 테스트"), Visitor.GetProgress() < 1.f);
+
+		// 아직 방문하지 않은 객체가 파괴되면 건너뜀
+		Targets.Last()->MarkAsGarbage();
+
+		while (!Visitor.Tick(0.))
+		{
+		}
+
+		TestEqual(TEXT("나누어 순회 테스트"), Count, 9 * 3);
+		TestEqual(TEXT("나누어 순회 테스트"), Visitor.GetProgress(), 1.f);
+	}
+
+	{
+		const TCHAR* CacheFileName = TEXT("Automation/ReflectionHelperLayoutTest.bin");
+		const FString CacheFilePath = FPaths::ProjectSavedDir() / CacheFileName;
+		IFileManager::Get().Delete(*CacheFilePath, false, false, true);
+
+		const TArray<const UStruct*> Structs = Details::GetStructsInModule(TEXT("ReflectionDemo"));
+		TestTrue(TEXT("레이아웃 미리 만들기 테스트"), Structs.Contains(UReflectionHelperTestObject::StaticClass()));
+		TestTrue(TEXT("레이아웃 미리 만들기 테스트"), Structs.Contains(FReflectionHelperTestStruct::StaticStruct()));
+
+		TestEqual(TEXT("레이아웃 미리 만들기 테스트"), FReflectionHelper::PrewarmLayouts<int32, float, TArray<int32>>(Structs, CacheFileName), 0);
+		TestTrue(TEXT("레이아웃 미리 만들기 테스트"), IFileManager::Get().FileExists(*CacheFilePath));
+
+		// 두 번째는 모두 파일에서 읽어야 하고, 파일에서 읽은 Layout도 직접 계산한 것과 같아야 함
+		FReflectionHelper::InvalidateLayoutCache();
+		TestEqual(TEXT("레이아웃 미리 만들기 테스트"), FReflectionHelper::PrewarmLayouts<int32, float, TArray<int32>>(Structs, CacheFileName), Structs.Num() * 3);
+
+		UReflectionHelperTestObject* Target = NewObject<UReflectionHelperTestObject>();
+		Target->Int32Member = 1;
+		Target->Int32Member2 = 2;
+		Target->Int32Member3 = 3;
+
+		int32 Sum = 0;
+		FReflectionHelper::ForEachMember(Target, [&](int32& Each)
+		{
+			Sum += Each;
+		});
+		TestEqual(TEXT("레이아웃 미리 만들기 테스트"), Sum, 6);
+
+		IFileManager::Get().Delete(*CacheFilePath, false, false, true);
+	}
+
+	{
+		FReflectionHelperTestBitfieldStruct Target;
+		Target.bFlag1 = true;
+		Target.Int32Member = 7;
+
+		// 비트필드는 한 비트만 읽고 써야 함
+		int32 NumTrue = 0;
+		FReflectionHelper::ForEachMember(Target, [&](bool& Each)
+		{
+			NumTrue += Each ? 1 : 0;
+			Each = !Each;
+		});
+		TestEqual(TEXT("비트필드 bool 테스트"), NumTrue, 1);
+		TestTrue(TEXT("비트필드 bool 테스트"), Target.bNative && Target.bFlag0 && !Target.bFlag1 && Target.bFlag2 && Target.bFlag3 && Target.bNativeLast);
+		TestEqual(TEXT("비트필드 bool 테스트"), Target.Int32Member, 7);
+
+		// 비트필드와 일반 bool이 섞여 있어도 선언 순서대로 방문
+		TArray<FName> Names;
+		FReflectionHelper::ForEachMember(Target, [&](const bool& Each, FName Name)
+		{
+			TestEqual(TEXT("비트필드 bool 테스트"), Each, Name != TEXT("bFlag1"));
+			Names.Add(Name);
+		});
+		TestTrue(TEXT("비트필드 bool 테스트"), Names == TArray<FName>{ TEXT("bNative"), TEXT("bFlag0"), TEXT("bFlag1"), TEXT("bFlag2"), TEXT("bFlag3"), TEXT("bNativeLast") });
+
+		// 선언 순서: bNative, bFlag0, bFlag1, bFlag2, bFlag3, bNativeLast
+		TBitArray<> Mask;
+		FReflectionHelper::ReadBoolMask(Target, Mask);
+		TestEqual(TEXT("비트필드 bool 테스트"), Mask.Num(), 6);
+		TestTrue(TEXT("비트필드 bool 테스트"), Mask[0] && Mask[1] && !Mask[2] && Mask[3] && Mask[4] && Mask[5]);
+
+		// ForEachMember와 같은 순서로 모음
+		TArray<FReflectionHelperTestBitfieldStruct*> Targets{ &Target };
+		TReflectionMemberColumns<bool> Columns;
+		TestTrue(TEXT("비트필드 bool 테스트"), FReflectionHelper::GatherMembers(MakeArrayView(Targets), Columns));
+		TestTrue(TEXT("비트필드 bool 테스트"), Columns.NumMembers == 6 && !Columns.Values[2] && Columns.Values[5]);
+
+		FReflectionHelperTestBitfieldStruct Other;
+		TestTrue(TEXT("비트필드 bool 테스트"), FReflectionHelper::WriteBoolMask(Other, Mask));
+		TestTrue(TEXT("비트필드 bool 테스트"), Other.bNative && Other.bFlag0 && !Other.bFlag1 && Other.bFlag2 && Other.bFlag3 && Other.bNativeLast);
+		TestEqual(TEXT("비트필드 bool 테스트"), Other.Int32Member, 0);
+
+		TestFalse(TEXT("비트필드 bool 테스트"), FReflectionHelper::WriteBoolMask(Other, TBitArray<>{ false, 3 }));
+
+		// ForEachMemberOf와 ForEachMemberDeep도 ForEachMember와 같은 멤버를 같은 순서로 방문
+		TArray<bool> Values;
+		FReflectionHelper::ForEachMemberOf(Target, [&](bool Each) { Values.Add(Each); }, [](int32& Each) {});
+		TestTrue(TEXT("비트필드 bool 테스트"), Values == TArray<bool>{ true, true, false, true, true, true });
+
+		Values.Reset();
+		FReflectionHelper::ForEachMemberDeep(Target, [&](const bool& Each) { Values.Add(Each); });
+		TestTrue(TEXT("비트필드 bool 테스트"), Values == TArray<bool>{ true, true, false, true, true, true });
+
+		FReflectionHelper::ForEachMemberOf(Target, [](bool& Each) { Each = false; });
+		TestTrue(TEXT("비트필드 bool 테스트"), !Target.bNative && !Target.bFlag0 && !Target.bFlag2 && !Target.bFlag3 && !Target.bNativeLast);
+
+		FReflectionHelper::ForEachMemberDeep(Target, [](bool& Each) { Each = true; });
+		TestTrue(TEXT("비트필드 bool 테스트"), Target.bNative && Target.bFlag0 && Target.bFlag1 && Target.bFlag2 && Target.bFlag3 && Target.bNativeLast);
+		TestEqual(TEXT("비트필드 bool 테스트"), Target.Int32Member, 7);
+	}
+
+	{
+		FReflectionHelperTestPolymorphicStruct Target;
+		Target.Base = NewObject<UReflectionHelperTestObject>();
+		Target.Sub = NewObject<UReflectionHelperTestSubObject>();
+		Target.AnyObject = NewObject<UReflectionHelperTestObject>();
+
+		int32 NumExact = 0;
+		FReflectionHelper::ForEachMember(Target, [&](UReflectionHelperTestObject* Each)
+		{
+			NumExact++;
+		});
+		TestEqual(TEXT("하위 클래스 순회 테스트"), NumExact, 1);
+
+		TArray<UReflectionHelperTestObject*> Visited;
+		FReflectionHelper::ForEachMemberPolymorphic(Target, [&](UReflectionHelperTestObject* Each)
+		{
+			Visited.Add(Each);
+		});
+		TestTrue(TEXT("하위 클래스 순회 테스트"), Visited == TArray<UReflectionHelperTestObject*>{ Target.Base, Target.Sub });
+
+		int32 NumObjects = 0;
+		FReflectionHelper::ForEachMemberPolymorphic(&Target, [&](UObject* const& Each)
+		{
+			NumObjects++;
+		});
+		TestEqual(TEXT("하위 클래스 순회 테스트"), NumObjects, 3);
+
+		int32 NumSoft = 0;
+		FReflectionHelper::ForEachMemberPolymorphic(Target, [&](const TSoftObjectPtr<UReflectionHelperTestObject>& Each)
+		{
+			NumSoft++;
+		});
+		FReflectionHelper::ForEachMemberPolymorphic(Target, [&](TSoftClassPtr<UObject> Each)
+		{
+			NumSoft++;
+		});
+		TestEqual(TEXT("하위 클래스 순회 테스트"), NumSoft, 2);
+
+		// 컴파일 에러
+		//FReflectionHelper::ForEachMemberPolymorphic(Target, [&](UObject*& Each) { });
+	}
+
+	{
+		FReflectionHelperTestExtendedTypesStruct Target;
+		Target.Int64Member = static_cast<int64>(1) << 40;
+		Target.UInt8Member = 200;
+		Target.DoubleMember = 0.5;
+		Target.NameMember = TEXT("Name");
+		Target.TextMember = FText::FromString(TEXT("Text"));
+		Target.EnumMember = EReflectionHelperTestEnum::C;
+		Target.NameSet.Add(TEXT("A"));
+		Target.ObjectPtr = NewObject<UReflectionHelperTestObject>();
+		Target.RawObject = NewObject<UReflectionHelperTestObject>();
+		Target.WeakObjectPtr = Target.RawObject;
+		Target.LazyObjectPtr = Target.RawObject;
+
+		int32 Count = 0;
+		FReflectionHelper::ForEachMember(Target, [&](int64& Each) { Count++; TestEqual(TEXT("확장 타입 순회 테스트"), Each, Target.Int64Member); });
+		FReflectionHelper::ForEachMember(Target, [&](uint8& Each) { Count++; TestEqual(TEXT("확장 타입 순회 테스트"), Each, static_cast<uint8>(200)); });
+		FReflectionHelper::ForEachMember(Target, [&](double& Each) { Count++; TestEqual(TEXT("확장 타입 순회 테스트"), Each, 0.5); });
+		FReflectionHelper::ForEachMember(Target, [&](const FName& Each) { Count++; TestEqual(TEXT("확장 타입 순회 테스트"), Each, FName{ TEXT("Name") }); });
+		FReflectionHelper::ForEachMember(Target, [&](const FText& Each) { Count++; TestEqual(TEXT("확장 타입 순회 테스트"), Each.ToString(), FString{ TEXT("Text") }); });
+		FReflectionHelper::ForEachMember(Target, [&](EReflectionHelperTestEnum& Each) { Count++; TestTrue(TEXT("확장 타입 순회 테스트"), Each == EReflectionHelperTestEnum::C); });
+		FReflectionHelper::ForEachMember(Target, [&](TSet<FName>& Each) { Count++; TestTrue(TEXT("확장 타입 순회 테스트"), Each.Contains(TEXT("A"))); });
+		FReflectionHelper::ForEachMember(Target, [&](TWeakObjectPtr<UReflectionHelperTestObject>& Each) { Count++; TestTrue(TEXT("확장 타입 순회 테스트"), Each == Target.RawObject); });
+		FReflectionHelper::ForEachMember(Target, [&](TLazyObjectPtr<UReflectionHelperTestObject>& Each) { Count++; TestTrue(TEXT("확장 타입 순회 테스트"), Each == Target.RawObject); });
+		TestEqual(TEXT("확장 타입 순회 테스트"), Count, 9);
+
+		// TObjectPtr과 UObject* 멤버는 어느 쪽으로 받아도 둘 다 방문됨
+		TArray<UReflectionHelperTestObject*> Handles;
+		FReflectionHelper::ForEachMember(Target, [&](TObjectPtr<UReflectionHelperTestObject>& Each)
+		{
+			Handles.Add(Each.Get());
+		});
+		TestTrue(TEXT("확장 타입 순회 테스트"), Handles == TArray<UReflectionHelperTestObject*>{ Target.ObjectPtr, Target.RawObject });
+
+		TArray<UReflectionHelperTestObject*> Pointers;
+		FReflectionHelper::ForEachMember(Target, [&](UReflectionHelperTestObject* Each)
+		{
+			Pointers.Add(Each);
+		});
+		TestTrue(TEXT("확장 타입 순회 테스트"), Pointers == Handles);
+
+		// TArray<TObjectPtr<T>> 멤버는 TArray<T*>로도 받을 수 있고 원소도 해석된 상태로 넘어옴
+		static_assert(Details::THasRawObjectPointer<TMap<int32, UObject*>>::value && !Details::THasRawObjectPointer<TArray<int32>>::value);
+
+		Target.ObjectPtrArray = { Target.ObjectPtr, Target.RawObject };
+
+		int32 NumArrays = 0;
+		FReflectionHelper::ForEachMember(Target, [&](const TArray<UReflectionHelperTestObject*>& Each)
+		{
+			NumArrays++;
+			TestTrue(TEXT("확장 타입 순회 테스트"), Each == Handles);
+		});
+		TestEqual(TEXT("확장 타입 순회 테스트"), NumArrays, 1);
+
+		Pointers.Reset();
+		FReflectionHelper::ForEachElement(Target, [&](UReflectionHelperTestObject* Each)
+		{
+			Pointers.Add(Each);
+		});
+		TestTrue(TEXT("확장 타입 순회 테스트"), Pointers == Handles);
+	}
+
+	{
+		// Root -> A -> B -> Root 순환과 Root -> C, D는 Root를 가리키지만 Root에서 도달할 수 없음
+		UReflectionHelperTestObject* Root = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* A = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* B = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* C = NewObject<UReflectionHelperTestObject>();
+		UReflectionHelperTestObject* D = NewObject<UReflectionHelperTestObject>();
+		Root->Object = A;
+		Root->Object3 = C;
+		A->Object2 = B;
+		B->Object = Root;
+		D->Object = Root;
+
+		FCriticalSection Lock;
+		TArray<UObject*> Visited;
+		FReflectionHelper::VisitReachable(Root, [&](UObject* Each)
+		{
+			FScopeLock ScopeLock{ &Lock };
+			Visited.Add(Each);
+		});
+
+		TestEqual(TEXT("도달 가능한 객체 순회 테스트"), Visited.Num(), 4);
+		TestTrue(TEXT("도달 가능한 객체 순회 테스트"), Visited.Contains(Root) && Visited.Contains(A) && Visited.Contains(B) && Visited.Contains(C));
+		TestFalse(TEXT("도달 가능한 객체 순회 테스트"), Visited.Contains(D));
+
+		// false를 반환한 객체의 멤버는 따라가지 않음
+		std::atomic<int32> Count = 0;
+		FReflectionHelper::VisitReachable(Root, [&](UObject* Each)
+		{
+			Count++;
+			return Each != A;
+		});
+		TestEqual(TEXT("도달 가능한 객체 순회 테스트"), Count.load(), 3);
+
+		// TScriptInterface 멤버도 따라감
+		UReflectionHelperTestSubObject* Sub = NewObject<UReflectionHelperTestSubObject>();
+		UReflectionHelperTestSubObject* Implementer = NewObject<UReflectionHelperTestSubObject>();
+		Sub->Interface = Implementer;
+
+		Visited.Reset();
+		FReflectionHelper::VisitReachable(Sub, [&](UObject* Each)
+		{
+			FScopeLock ScopeLock{ &Lock };
+			Visited.Add(Each);
+		});
+		TestTrue(TEXT("도달 가능한 객체 순회 테스트"), Visited.Num() == 2 && Visited.Contains(Implementer));
+
+		// TArray<자기 자신>을 가진 구조체 안의 참조와 TMap의 값도 따라감
+		UReflectionHelperTestRecursiveObject* Holder = NewObject<UReflectionHelperTestRecursiveObject>();
+		Holder->Tree.Children.AddDefaulted_GetRef().Children.AddDefaulted_GetRef().Object = A;
+		Holder->ObjectMap.Add(1, C);
+		Holder->StringMap.Add(2, TEXT("NoReference"));
+
+		Visited.Reset();
+		FReflectionHelper::VisitReachable(Holder, [&](UObject* Each)
+		{
+			FScopeLock ScopeLock{ &Lock };
+			Visited.Add(Each);
+			return Each == Holder;
+		});
+		TestTrue(TEXT("도달 가능한 객체 순회 테스트"), Visited.Num() == 3 && Visited.Contains(A) && Visited.Contains(C));
+	}
 	
 	return true;
 }
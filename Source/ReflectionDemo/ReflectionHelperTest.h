@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/Interface.h"
 #include "ReflectionHelperTest.generated.h"
 
 
@@ -49,6 +50,39 @@ struct FReflectionHelperTestStruct
 };
 
 
+USTRUCT()
+struct FReflectionHelperTestBitfieldStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bNative = false;
+
+	UPROPERTY()
+	uint8 bFlag0 : 1;
+
+	UPROPERTY()
+	uint8 bFlag1 : 1;
+
+	UPROPERTY()
+	uint8 bFlag2 : 1;
+
+	UPROPERTY()
+	int32 Int32Member = 0;
+
+	UPROPERTY()
+	uint8 bFlag3 : 1;
+
+	UPROPERTY()
+	bool bNativeLast = false;
+
+	FReflectionHelperTestBitfieldStruct()
+		: bFlag0(false), bFlag1(false), bFlag2(false), bFlag3(false)
+	{
+	}
+};
+
+
 UCLASS()
 class UReflectionHelperTestObject : public UObject
 {
@@ -100,6 +134,9 @@ public:
 	UPROPERTY()
 	FReflectionHelperTestStruct Struct3;
 
+	UPROPERTY()
+	TArray<FReflectionHelperTestStruct> StructArray;
+
 	UPROPERTY()
 	UReflectionHelperTestObject* Object;
 
@@ -138,4 +175,140 @@ public:
 
 	UPROPERTY()
 	TMap<int32, float> Map2;
+
+	UPROPERTY()
+	TMap<int32, int32> Int32Map;
+
+	UPROPERTY()
+	TSet<int32> Int32Set;
+
+	UPROPERTY()
+	FString StringMember;
+};
+
+
+UINTERFACE()
+class UReflectionHelperTestInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class IReflectionHelperTestInterface
+{
+	GENERATED_BODY()
+};
+
+
+UCLASS()
+class UReflectionHelperTestSubObject : public UReflectionHelperTestObject, public IReflectionHelperTestInterface
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TScriptInterface<IReflectionHelperTestInterface> Interface;
+};
+
+
+USTRUCT()
+struct FReflectionHelperTestPolymorphicStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UReflectionHelperTestObject* Base = nullptr;
+
+	UPROPERTY()
+	UReflectionHelperTestSubObject* Sub = nullptr;
+
+	UPROPERTY()
+	UObject* AnyObject = nullptr;
+
+	UPROPERTY()
+	TSoftObjectPtr<UReflectionHelperTestSubObject> SoftSub;
+
+	UPROPERTY()
+	TSoftClassPtr<UReflectionHelperTestSubObject> SoftClassSub;
+};
+
+
+UENUM()
+enum class EReflectionHelperTestEnum : uint8
+{
+	A,
+	B,
+	C,
+};
+
+
+USTRUCT()
+struct FReflectionHelperTestExtendedTypesStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int64 Int64Member = 0;
+
+	UPROPERTY()
+	uint8 UInt8Member = 0;
+
+	UPROPERTY()
+	double DoubleMember = 0.;
+
+	UPROPERTY()
+	FName NameMember;
+
+	UPROPERTY()
+	FText TextMember;
+
+	UPROPERTY()
+	EReflectionHelperTestEnum EnumMember = EReflectionHelperTestEnum::A;
+
+	UPROPERTY()
+	TSet<FName> NameSet;
+
+	UPROPERTY()
+	TObjectPtr<UReflectionHelperTestObject> ObjectPtr;
+
+	UPROPERTY()
+	UReflectionHelperTestObject* RawObject = nullptr;
+
+	UPROPERTY()
+	TWeakObjectPtr<UReflectionHelperTestObject> WeakObjectPtr;
+
+	UPROPERTY()
+	TLazyObjectPtr<UReflectionHelperTestObject> LazyObjectPtr;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UReflectionHelperTestObject>> ObjectPtrArray;
+};
+
+
+USTRUCT()
+struct FReflectionHelperTestRecursiveStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FReflectionHelperTestRecursiveStruct> Children;
+
+	UPROPERTY()
+	TObjectPtr<UObject> Object;
+};
+
+
+UCLASS()
+class UReflectionHelperTestRecursiveObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FReflectionHelperTestRecursiveStruct Tree;
+
+	UPROPERTY()
+	TMap<int32, TObjectPtr<UObject>> ObjectMap;
+
+	UPROPERTY()
+	TMap<int32, FString> StringMap;
 };